@@ -1,6 +1,6 @@
 function(AddGTest)
     set(options "")
-    set(one_value_args NAME FILENAME)
+    set(one_value_args NAME FILENAME TEST_PREFIX)
     set(multi_value_args DEPS)
     cmake_parse_arguments(
             GTEST_ADD_TEST
@@ -11,5 +11,5 @@ function(AddGTest)
     )
     add_executable(${GTEST_ADD_TEST_NAME} ${GTEST_ADD_TEST_FILENAME})
     target_link_libraries(${GTEST_ADD_TEST_NAME} PRIVATE GTest::gtest_main ${GTEST_ADD_TEST_DEPS})
-    gtest_discover_tests(${GTEST_ADD_TEST_NAME})
+    gtest_discover_tests(${GTEST_ADD_TEST_NAME} TEST_PREFIX "${GTEST_ADD_TEST_TEST_PREFIX}")
 endfunction()
\ No newline at end of file
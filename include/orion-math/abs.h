@@ -1,6 +1,6 @@
 #pragma once
 
-#include <concepts> // std::floating_point, std::integral
+#include <concepts> // std::floating_point, std::signed_integral, std::unsigned_integral
 
 namespace orion::math
 {
@@ -12,9 +12,18 @@ namespace orion::math
         return -value;
     }
 
-    template<std::integral Integral>
-    [[nodiscard]] double abs(Integral value) noexcept
+    // The most negative value has no positive counterpart and is left to the caller
+    template<std::signed_integral Integral>
+    [[nodiscard]] constexpr Integral abs(Integral value) noexcept
     {
-        return abs(static_cast<double>(value));
+        if (value < 0)
+            return static_cast<Integral>(-value);
+        return value;
+    }
+
+    template<std::unsigned_integral Integral>
+    [[nodiscard]] constexpr Integral abs(Integral value) noexcept
+    {
+        return value;
     }
 } // namespace orion::math
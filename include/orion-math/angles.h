@@ -107,8 +107,8 @@ namespace orion::math
     namespace angle_literals
     {
         [[nodiscard]] constexpr Radians operator"" _rad(long double value) { return Radians{value}; }
-        [[nodiscard]] constexpr Radians operator"" _rad(std::uint64_t value) { return Radians{value}; }
+        [[nodiscard]] constexpr Radians operator"" _rad(unsigned long long value) { return Radians{value}; }
         [[nodiscard]] constexpr Degrees operator"" _deg(long double value) { return Degrees{value}; }
-        [[nodiscard]] constexpr Degrees operator"" _deg(std::uint64_t value) { return Degrees{value}; }
+        [[nodiscard]] constexpr Degrees operator"" _deg(unsigned long long value) { return Degrees{value}; }
     } // namespace angle_literals
 } // namespace orion::math
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "orion-math/instrument.h"     // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/matrix/matrix.h"  // detail::static_for
+#include "orion-math/parallel.h"       // parallel_for
+#include "orion-math/simd.h"           // simd::Pack
+#include "orion-math/vector/quaternion.h"
+#include "orion-math/vector/vector3.h"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+
+namespace orion::math
+{
+    // Structure of arrays view of a skeleton pose, one entry per joint
+    template<typename T>
+    struct PoseView {
+        std::span<const Vector3_t<T>> translations;
+        std::span<const Quaternion_t<T>> rotations;
+        std::span<const Vector3_t<T>> scales;
+    };
+
+    template<typename T>
+    struct PoseBuffer {
+        std::span<Vector3_t<T>> translations;
+        std::span<Quaternion_t<T>> rotations;
+        std::span<Vector3_t<T>> scales;
+    };
+
+    namespace detail
+    {
+        template<typename T>
+        struct UniformWeight {
+            T weight;
+            [[nodiscard]] T operator()(std::size_t) const noexcept { return weight; }
+        };
+
+        template<typename T>
+        struct ElementWeight {
+            std::span<const T> weights;
+            [[nodiscard]] T operator()(std::size_t i) const noexcept { return weights[i]; }
+        };
+
+        // Rotations blended per iteration, one per lane. Each quaternion
+        // component becomes one pack, so the renormalization of blend_lanes
+        // rotations is one packed square root. The loops over lanes and
+        // components go through static_for, -O2 leaves them rolled otherwise
+        // and keeps every pack in memory.
+        inline constexpr std::size_t blend_lanes = 4;
+
+        template<typename T>
+        using BlendPack = simd::Pack<T, blend_lanes>;
+
+        using BlendLanes = std::array<std::size_t, blend_lanes>;
+
+        // Indices of the values blended by the iteration starting at first. The
+        // end of a range is padded with its last value, so every value takes
+        // the same path wherever the range ends.
+        [[nodiscard]] inline BlendLanes blend_indices(std::size_t first, std::size_t count) noexcept
+        {
+            BlendLanes indices;
+            static_for<0, blend_lanes>([&](auto lane) { indices[lane] = first + (lane < count ? lane : count - 1); });
+            return indices;
+        }
+
+        template<typename T>
+        [[nodiscard]] BlendPack<T> load_weights(auto weight, const BlendLanes& indices) noexcept
+        {
+            std::array<T, blend_lanes> weights;
+            static_for<0, blend_lanes>([&](auto lane) { weights[lane] = weight(indices[lane]); });
+            return BlendPack<T>::load(weights.data());
+        }
+
+        // Pack c holds component c of values[indices[lane]] in each lane
+        template<typename T, std::size_t N>
+        [[nodiscard]] std::array<BlendPack<T>, N> load_lanes(std::span<const Vector<T, N>> values, const BlendLanes& indices) noexcept
+        {
+            std::array<std::array<T, blend_lanes>, N> components;
+            static_for<0, blend_lanes>([&](auto lane) {
+                const auto& value = values[indices[lane]];
+                static_for<0, N>([&](auto component) { components[component][lane] = value[component]; });
+            });
+            std::array<BlendPack<T>, N> packs;
+            static_for<0, N>([&](auto component) { packs[component] = BlendPack<T>::load(components[component].data()); });
+            return packs;
+        }
+
+        // Writes the first count lanes to values[first, first + count)
+        template<typename T, std::size_t N>
+        void store_lanes(const std::array<BlendPack<T>, N>& packs, std::span<Vector<T, N>> values, std::size_t first, std::size_t count) noexcept
+        {
+            std::array<std::array<T, blend_lanes>, N> components;
+            static_for<0, N>([&](auto component) { packs[component].store(components[component].data()); });
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                auto& value = values[first + lane];
+                static_for<0, N>([&](auto component) { value[component] = components[component][lane]; });
+            }
+        }
+
+        // The scalar nlerp lane by lane, except that it scales by one inverse magnitude
+        template<typename T>
+        [[nodiscard]] std::array<BlendPack<T>, 4> nlerp_lanes(const std::array<BlendPack<T>, 4>& from, const std::array<BlendPack<T>, 4>& to, const BlendPack<T>& t) noexcept
+        {
+            auto cos_angle = from[0] * to[0];
+            static_for<1, 4>([&](auto component) { cos_angle = fmadd(from[component], to[component], cos_angle); });
+            // Shortest arc: lanes whose rotations point apart blend towards -to
+            const auto sign = select(cos_angle < BlendPack<T>::broadcast(T{0}), BlendPack<T>::broadcast(T{-1}), BlendPack<T>::broadcast(T{1}));
+            std::array<BlendPack<T>, 4> blended;
+            static_for<0, 4>([&](auto component) { blended[component] = fmadd(to[component] * sign - from[component], t, from[component]); });
+            auto sqr_magnitude = blended[0] * blended[0];
+            static_for<1, 4>([&](auto component) { sqr_magnitude = fmadd(blended[component], blended[component], sqr_magnitude); });
+            const auto inverse_magnitude = BlendPack<T>::broadcast(T{1}) / sqrt(sqr_magnitude);
+            static_for<0, 4>([&](auto component) { blended[component] = blended[component] * inverse_magnitude; });
+            return blended;
+        }
+
+        template<typename T>
+        void lerp_range(std::span<const Vector3_t<T>> from, std::span<const Vector3_t<T>> to, auto weight, std::span<Vector3_t<T>> result, std::size_t begin, std::size_t end) noexcept
+        {
+            for (auto i = begin; i < end; ++i) {
+                result[i] = lerp(from[i], to[i], weight(i));
+            }
+        }
+
+        template<typename T>
+        void nlerp_range(std::span<const Quaternion_t<T>> from, std::span<const Quaternion_t<T>> to, auto weight, std::span<Quaternion_t<T>> result, std::size_t begin, std::size_t end) noexcept
+        {
+            for (auto first = begin; first < end; first += blend_lanes) {
+                const auto count = end - first < blend_lanes ? end - first : blend_lanes;
+                const auto indices = blend_indices(first, count);
+                const auto t = load_weights<T>(weight, indices);
+                store_lanes(nlerp_lanes(load_lanes(from, indices), load_lanes(to, indices), t), result, first, count);
+            }
+        }
+
+        // One pass over the joints, blend_lanes of them per iteration. Rotations
+        // go through nlerp_lanes; translations and scales are plain lerps, three
+        // fmadds a joint that cost less than gathering them into packs would.
+        template<typename T>
+        void blend_pose_range(const PoseView<T>& from, const PoseView<T>& to, auto weight, const PoseBuffer<T>& result, std::size_t begin, std::size_t end) noexcept
+        {
+            for (auto first = begin; first < end; first += blend_lanes) {
+                const auto count = end - first < blend_lanes ? end - first : blend_lanes;
+                const auto indices = blend_indices(first, count);
+                const auto t = load_weights<T>(weight, indices);
+                for (auto joint = first; joint < first + count; ++joint) {
+                    result.translations[joint] = lerp(from.translations[joint], to.translations[joint], weight(joint));
+                    result.scales[joint] = lerp(from.scales[joint], to.scales[joint], weight(joint));
+                }
+                store_lanes(nlerp_lanes(load_lanes(from.rotations, indices), load_lanes(to.rotations, indices), t), result.rotations, first, count);
+            }
+        }
+
+        inline void check_blend_sizes(std::size_t from, std::size_t to, std::size_t weights, std::size_t result)
+        {
+            if (from != to || from != weights || from != result) {
+                throw std::invalid_argument("batch spans must have the same size");
+            }
+        }
+
+        template<typename T>
+        void blend_poses(const PoseView<T>& from, const PoseView<T>& to, auto weight, const PoseBuffer<T>& result, unsigned thread_count)
+        {
+            const auto count = result.rotations.size();
+            if (from.translations.size() != count || from.rotations.size() != count || from.scales.size() != count ||
+                to.translations.size() != count || to.rotations.size() != count || to.scales.size() != count ||
+                result.translations.size() != count || result.scales.size() != count) {
+                throw std::invalid_argument("pose spans must have the same size");
+            }
+            ORION_MATH_INSTRUMENT_BATCH(count);
+            parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                blend_pose_range(from, to, weight, result, begin, end);
+            });
+        }
+    } // namespace detail
+
+    // result[i] = lerp(from[i], to[i], weights[i])
+    template<typename T = float>
+    void lerp(std::type_identity_t<std::span<const Vector3_t<T>>> from,
+              std::type_identity_t<std::span<const Vector3_t<T>>> to,
+              std::type_identity_t<std::span<const T>> weights,
+              std::type_identity_t<std::span<Vector3_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), weights.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        detail::lerp_range(from, to, detail::ElementWeight<T>{weights}, result, 0, result.size());
+    }
+
+    // result[i] = lerp(from[i], to[i], weight)
+    template<typename T = float>
+    void lerp(std::type_identity_t<std::span<const Vector3_t<T>>> from,
+              std::type_identity_t<std::span<const Vector3_t<T>>> to,
+              std::type_identity_t<T> weight,
+              std::type_identity_t<std::span<Vector3_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), result.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        detail::lerp_range(from, to, detail::UniformWeight<T>{weight}, result, 0, result.size());
+    }
+
+    // result[i] = nlerp(from[i], to[i], weights[i])
+    template<typename T = float>
+    void nlerp(std::type_identity_t<std::span<const Quaternion_t<T>>> from,
+               std::type_identity_t<std::span<const Quaternion_t<T>>> to,
+               std::type_identity_t<std::span<const T>> weights,
+               std::type_identity_t<std::span<Quaternion_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), weights.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        detail::nlerp_range(from, to, detail::ElementWeight<T>{weights}, result, 0, result.size());
+    }
+
+    // result[i] = nlerp(from[i], to[i], weight)
+    template<typename T = float>
+    void nlerp(std::type_identity_t<std::span<const Quaternion_t<T>>> from,
+               std::type_identity_t<std::span<const Quaternion_t<T>>> to,
+               std::type_identity_t<T> weight,
+               std::type_identity_t<std::span<Quaternion_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), result.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        detail::nlerp_range(from, to, detail::UniformWeight<T>{weight}, result, 0, result.size());
+    }
+
+    // result[i] = slerp(from[i], to[i], weights[i]). Evaluated one rotation at
+    // a time, prefer nlerp where constant angular velocity is not required.
+    template<typename T = float>
+    void slerp(std::type_identity_t<std::span<const Quaternion_t<T>>> from,
+               std::type_identity_t<std::span<const Quaternion_t<T>>> to,
+               std::type_identity_t<std::span<const T>> weights,
+               std::type_identity_t<std::span<Quaternion_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), weights.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = slerp(from[i], to[i], weights[i]);
+        }
+    }
+
+    // result[i] = slerp(from[i], to[i], weight)
+    template<typename T = float>
+    void slerp(std::type_identity_t<std::span<const Quaternion_t<T>>> from,
+               std::type_identity_t<std::span<const Quaternion_t<T>>> to,
+               std::type_identity_t<T> weight,
+               std::type_identity_t<std::span<Quaternion_t<T>>> result)
+    {
+        detail::check_blend_sizes(from.size(), to.size(), result.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = slerp(from[i], to[i], weight);
+        }
+    }
+
+    // Blends two poses in a single pass over the joints: translations and
+    // scales with lerp, rotations with nlerp, four per iteration across SIMD
+    // lanes. weights holds one weight per joint.
+    template<typename T = float>
+    void blend_poses(const std::type_identity_t<PoseView<T>>& from,
+                     const std::type_identity_t<PoseView<T>>& to,
+                     std::type_identity_t<std::span<const T>> weights,
+                     const std::type_identity_t<PoseBuffer<T>>& result,
+                     unsigned thread_count = 1)
+    {
+        if (weights.size() != result.rotations.size()) {
+            throw std::invalid_argument("pose spans must have the same size");
+        }
+        detail::blend_poses(from, to, detail::ElementWeight<T>{weights}, result, thread_count);
+    }
+
+    template<typename T = float>
+    void blend_poses(const std::type_identity_t<PoseView<T>>& from,
+                     const std::type_identity_t<PoseView<T>>& to,
+                     std::type_identity_t<T> weight,
+                     const std::type_identity_t<PoseBuffer<T>>& result,
+                     unsigned thread_count = 1)
+    {
+        detail::blend_poses(from, to, detail::UniformWeight<T>{weight}, result, thread_count);
+    }
+} // namespace orion::math
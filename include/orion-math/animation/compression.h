@@ -0,0 +1,314 @@
+#pragma once
+
+#include "blend.h"                     // PoseBuffer
+#include "orion-math/vector/packing.h" // PackedQuaternion, pack_quaternion, unpack_quaternion
+#include "orion-math/vector/quaternion.h"
+#include "orion-math/vector/vector3.h"
+
+#include <algorithm>   // std::clamp, std::max, std::min, std::upper_bound
+#include <cmath>       // std::abs, std::acos, std::round, std::sqrt
+#include <cstddef>     // std::ptrdiff_t, std::size_t
+#include <cstdint>     // std::uint16_t, std::uint32_t
+#include <limits>      // std::numeric_limits
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::is_same_v
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Uncompressed clip sampled at a fixed rate. Channels are stored frame
+    // major, joint j of frame f lives at index f * joint_count + j.
+    struct RawClip {
+        float sample_rate = 30.f;
+        std::size_t joint_count = 0;
+        std::span<const Vector3_f> translations;
+        std::span<const Quaternion_f> rotations;
+        std::span<const Vector3_f> scales;
+    };
+
+    // Largest deviation from the original data at frames dropped by key
+    // reduction. It is measured against the decoded keys, so it includes the
+    // quantization error, kept frames only carry their quantization error
+    struct ClipCompressionSettings {
+        float translation_error = 1e-3f;
+        // Radians
+        float rotation_error = 1e-3f;
+        float scale_error = 1e-4f;
+    };
+
+    // Translation or scale key quantized to 16 bits per component over the range of its channel
+    using QuantizedVector3 = Vector3_t<std::uint16_t>;
+
+    // Keys of one joint channel, stored at [first_key, first_key + key_count)
+    struct KeyChannel {
+        std::uint32_t first_key = 0;
+        std::uint32_t key_count = 0;
+        Vector3_f minimum{0, 0, 0};
+        Vector3_f extent{0, 0, 0};
+    };
+
+    // All channels of one kind in a clip. The keys of a channel are contiguous
+    // and frames[k] is the frame index of keys[k].
+    template<typename Key>
+    struct KeyStream {
+        std::vector<KeyChannel> channels;
+        std::vector<std::uint16_t> frames;
+        std::vector<Key> keys;
+
+        [[nodiscard]] std::size_t size_bytes() const noexcept
+        {
+            return channels.size() * sizeof(KeyChannel) + frames.size() * sizeof(std::uint16_t) + keys.size() * sizeof(Key);
+        }
+    };
+
+    // Output of compress_clip, read by ClipSampler
+    struct CompressedClip {
+        float sample_rate = 30.f;
+        std::size_t frame_count = 0;
+        std::size_t joint_count = 0;
+        KeyStream<QuantizedVector3> translations;
+        KeyStream<PackedQuaternion> rotations;
+        KeyStream<QuantizedVector3> scales;
+
+        [[nodiscard]] float duration() const noexcept { return frame_count > 1 ? static_cast<float>(frame_count - 1) / sample_rate : 0.f; }
+
+        [[nodiscard]] std::size_t size_bytes() const noexcept
+        {
+            return sizeof(CompressedClip) + translations.size_bytes() + rotations.size_bytes() + scales.size_bytes();
+        }
+    };
+
+    namespace detail
+    {
+        [[nodiscard]] inline QuantizedVector3 quantize_range(const Vector3_f& value, const KeyChannel& channel) noexcept
+        {
+            QuantizedVector3 result;
+            for (std::size_t i = 0; i < 3; ++i) {
+                const auto normalized = channel.extent[i] > 0.f ? (value[i] - channel.minimum[i]) / channel.extent[i] : 0.f;
+                result[i] = static_cast<std::uint16_t>(std::round(std::clamp(normalized, 0.f, 1.f) * 65535.f));
+            }
+            return result;
+        }
+
+        [[nodiscard]] inline Vector3_f dequantize_range(const QuantizedVector3& key, const KeyChannel& channel) noexcept
+        {
+            Vector3_f result;
+            for (std::size_t i = 0; i < 3; ++i) {
+                result[i] = channel.minimum[i] + static_cast<float>(key[i]) / 65535.f * channel.extent[i];
+            }
+            return result;
+        }
+
+        // QuantizedVector3 and PackedQuaternion share a type, the decoded value type tells them apart
+        template<typename Value>
+        [[nodiscard]] inline Value decode_key(const Vector3_t<std::uint16_t>& key, const KeyChannel& channel) noexcept
+        {
+            if constexpr (std::is_same_v<Value, Quaternion_f>) {
+                return unpack_quaternion(key);
+            } else {
+                return dequantize_range(key, channel);
+            }
+        }
+
+        [[nodiscard]] inline Vector3_f interpolate_key(const Vector3_f& from, const Vector3_f& to, float t) noexcept { return lerp(from, to, t); }
+        [[nodiscard]] inline Quaternion_f interpolate_key(const Quaternion_f& from, const Quaternion_f& to, float t) noexcept { return nlerp(from, to, t); }
+
+        [[nodiscard]] inline float key_error(const Vector3_f& lhs, const Vector3_f& rhs) noexcept { return std::sqrt((lhs - rhs).sqr_magnitude()); }
+
+        [[nodiscard]] inline float key_error(const Quaternion_f& lhs, const Quaternion_f& rhs) noexcept
+        {
+            const auto cos_half_angle = std::min(1.f, std::abs(dot(lhs, rhs)));
+            return 2.f * std::acos(cos_half_angle);
+        }
+
+        // Greedy key reduction: starting from a kept key, the next kept key is a
+        // far frame for which interpolating between the two decoded keys
+        // reproduces every original frame in between within tolerance. The span
+        // is grown by doubling and then bisected, so each kept key costs
+        // O(span log span) frame checks instead of O(span^2). Whether a span fits
+        // is not strictly monotonic in its length, so the span chosen is always
+        // verified but not necessarily the longest one.
+        template<typename Value, typename Key>
+        void reduce_channel(std::span<const Value> original, std::span<const Key> quantized, const KeyChannel& range, float tolerance, KeyStream<Key>& stream)
+        {
+            auto keep = [&](std::size_t frame) {
+                stream.frames.push_back(static_cast<std::uint16_t>(frame));
+                stream.keys.push_back(quantized[frame]);
+            };
+            auto fits = [&](std::size_t from, std::size_t to) {
+                const auto first = decode_key<Value>(quantized[from], range);
+                const auto last = decode_key<Value>(quantized[to], range);
+                for (auto frame = from + 1; frame < to; ++frame) {
+                    const auto t = static_cast<float>(frame - from) / static_cast<float>(to - from);
+                    if (key_error(interpolate_key(first, last, t), original[frame]) > tolerance) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            const auto first_key = stream.keys.size();
+            const auto last_frame = original.size() - 1;
+            std::size_t key = 0;
+            keep(key);
+            while (key < last_frame) {
+                // Adjacent keys always fit, bad is the first span known not to
+                auto good = key + 1;
+                auto bad = last_frame + 1;
+                for (std::size_t length = 2; good < last_frame; length *= 2) {
+                    const auto candidate = std::min(key + length, last_frame);
+                    if (!fits(key, candidate)) {
+                        bad = candidate;
+                        break;
+                    }
+                    good = candidate;
+                }
+                while (bad - good > 1) {
+                    const auto middle = good + (bad - good) / 2;
+                    if (fits(key, middle)) {
+                        good = middle;
+                    } else {
+                        bad = middle;
+                    }
+                }
+                keep(good);
+                key = good;
+            }
+
+            auto channel = range;
+            channel.first_key = static_cast<std::uint32_t>(first_key);
+            channel.key_count = static_cast<std::uint32_t>(stream.keys.size() - first_key);
+            stream.channels.push_back(channel);
+        }
+
+        inline void compress_vectors(std::span<const Vector3_f> values, std::size_t joint_count, float tolerance, KeyStream<QuantizedVector3>& stream)
+        {
+            const auto frame_count = values.size() / joint_count;
+            std::vector<Vector3_f> original(frame_count);
+            std::vector<QuantizedVector3> quantized(frame_count);
+            for (std::size_t joint = 0; joint < joint_count; ++joint) {
+                KeyChannel range;
+                auto maximum = values[joint];
+                range.minimum = values[joint];
+                for (std::size_t frame = 0; frame < frame_count; ++frame) {
+                    original[frame] = values[frame * joint_count + joint];
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        range.minimum[i] = std::min(range.minimum[i], original[frame][i]);
+                        maximum[i] = std::max(maximum[i], original[frame][i]);
+                    }
+                }
+                range.extent = maximum - range.minimum;
+                for (std::size_t frame = 0; frame < frame_count; ++frame) {
+                    quantized[frame] = quantize_range(original[frame], range);
+                }
+                reduce_channel<Vector3_f, QuantizedVector3>(original, quantized, range, tolerance, stream);
+            }
+        }
+
+        inline void compress_rotations(std::span<const Quaternion_f> values, std::size_t joint_count, float tolerance, KeyStream<PackedQuaternion>& stream)
+        {
+            const auto frame_count = values.size() / joint_count;
+            std::vector<Quaternion_f> original(frame_count);
+            std::vector<PackedQuaternion> quantized(frame_count);
+            for (std::size_t joint = 0; joint < joint_count; ++joint) {
+                for (std::size_t frame = 0; frame < frame_count; ++frame) {
+                    original[frame] = values[frame * joint_count + joint];
+                    quantized[frame] = pack_quaternion(original[frame]);
+                }
+                reduce_channel<Quaternion_f, PackedQuaternion>(original, quantized, KeyChannel{}, tolerance, stream);
+            }
+        }
+    } // namespace detail
+
+    // Throws std::invalid_argument when the channels do not hold the same whole
+    // number of frames or the clip is longer than the 16 bit frame indices allow
+    [[nodiscard]] inline CompressedClip compress_clip(const RawClip& clip, const ClipCompressionSettings& settings = {})
+    {
+        const auto count = clip.rotations.size();
+        if (clip.joint_count == 0 || count == 0 || count % clip.joint_count != 0 || clip.translations.size() != count || clip.scales.size() != count) {
+            throw std::invalid_argument("clip channels must hold the same whole number of frames");
+        }
+        if (clip.sample_rate <= 0.f) {
+            throw std::invalid_argument("clip sample rate must be positive");
+        }
+
+        CompressedClip result;
+        result.sample_rate = clip.sample_rate;
+        result.joint_count = clip.joint_count;
+        result.frame_count = count / clip.joint_count;
+        if (result.frame_count > std::size_t{std::numeric_limits<std::uint16_t>::max()} + 1) {
+            throw std::invalid_argument("clip has more frames than 16 bit key frames can address");
+        }
+        detail::compress_vectors(clip.translations, clip.joint_count, settings.translation_error, result.translations);
+        detail::compress_rotations(clip.rotations, clip.joint_count, settings.rotation_error, result.rotations);
+        detail::compress_vectors(clip.scales, clip.joint_count, settings.scale_error, result.scales);
+        return result;
+    }
+
+    // Samples a compressed clip, decoding only the two keys around the sample
+    // time in each channel. The key found last is remembered per channel, so
+    // playing forward finds the next key without searching.
+    class ClipSampler
+    {
+    public:
+        // The clip must outlive the sampler
+        explicit ClipSampler(const CompressedClip& clip)
+            : clip_(&clip)
+            , translation_cursors_(clip.joint_count, 0)
+            , rotation_cursors_(clip.joint_count, 0)
+            , scale_cursors_(clip.joint_count, 0)
+        {
+        }
+
+        // Time in seconds, clamped to the clip. Throws std::invalid_argument
+        // when the pose does not hold one entry per joint.
+        void sample(float time, const PoseBuffer<float>& pose)
+        {
+            const auto joints = clip_->joint_count;
+            if (pose.translations.size() != joints || pose.rotations.size() != joints || pose.scales.size() != joints) {
+                throw std::invalid_argument("pose spans must hold one entry per joint");
+            }
+            ORION_MATH_INSTRUMENT_BATCH(joints);
+            const auto frame = std::clamp(time * clip_->sample_rate, 0.f, static_cast<float>(clip_->frame_count - 1));
+            for (std::size_t joint = 0; joint < joints; ++joint) {
+                pose.translations[joint] = sample_channel<Vector3_f>(clip_->translations, joint, frame, translation_cursors_[joint]);
+                pose.rotations[joint] = sample_channel<Quaternion_f>(clip_->rotations, joint, frame, rotation_cursors_[joint]);
+                pose.scales[joint] = sample_channel<Vector3_f>(clip_->scales, joint, frame, scale_cursors_[joint]);
+            }
+        }
+
+    private:
+        template<typename Value, typename Key>
+        [[nodiscard]] static Value sample_channel(const KeyStream<Key>& stream, std::size_t joint, float frame, std::uint32_t& cursor) noexcept
+        {
+            const auto& channel = stream.channels[joint];
+            const auto* frames = stream.frames.data() + channel.first_key;
+            const auto* keys = stream.keys.data() + channel.first_key;
+            const auto last = channel.key_count - 1;
+
+            auto contains = [&](std::uint32_t key) { return static_cast<float>(frames[key]) <= frame && (key == last || frame < static_cast<float>(frames[key + 1])); };
+            if (!contains(cursor)) {
+                if (cursor < last && contains(cursor + 1)) {
+                    ++cursor;
+                } else {
+                    const auto upper = std::upper_bound(frames, frames + channel.key_count, frame, [](float value, std::uint16_t key_frame) { return value < static_cast<float>(key_frame); });
+                    cursor = static_cast<std::uint32_t>(std::max<std::ptrdiff_t>(upper - frames - 1, 0));
+                }
+            }
+
+            const auto from = detail::decode_key<Value>(keys[cursor], channel);
+            if (cursor == last) {
+                return from;
+            }
+            const auto to = detail::decode_key<Value>(keys[cursor + 1], channel);
+            const auto t = (frame - static_cast<float>(frames[cursor])) / static_cast<float>(frames[cursor + 1] - frames[cursor]);
+            return detail::interpolate_key(from, to, t);
+        }
+
+        const CompressedClip* clip_;
+        std::vector<std::uint32_t> translation_cursors_;
+        std::vector<std::uint32_t> rotation_cursors_;
+        std::vector<std::uint32_t> scale_cursors_;
+    };
+} // namespace orion::math
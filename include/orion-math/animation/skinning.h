@@ -0,0 +1,171 @@
+#pragma once
+
+#include "orion-math/instrument.h"   // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/matrix/batch.h" // detail::Row4
+#include "orion-math/matrix/matrix4.h"
+#include "orion-math/parallel.h"     // parallel_for
+#include "orion-math/simd.h"         // simd::transpose
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint16_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+
+namespace orion::math
+{
+    inline constexpr std::size_t max_bone_influences = 4;
+
+    // Indices into the bone palette. Unused influences must still index a valid
+    // bone and carry a weight of 0.
+    using BoneIndices = Vector<std::uint16_t, max_bone_influences>;
+
+    namespace detail
+    {
+        template<typename T>
+        struct SkinningJob {
+            std::span<const Vector3_t<T>> positions;
+            std::span<const Vector3_t<T>> normals;
+            std::span<const BoneIndices> bones;
+            std::span<const Vector4_t<T>> weights;
+            std::span<const Matrix4_t<T>> palette;
+            std::span<Vector3_t<T>> skinned_positions;
+            std::span<Vector3_t<T>> skinned_normals;
+        };
+
+        // Vertices skinned per iteration, one per lane of a Row4
+        inline constexpr std::size_t skinning_lanes = 4;
+
+        // A chunk is only worth a thread when skinning it takes well over the
+        // tens of microseconds it costs to start one, at a few ns per vertex
+        inline constexpr std::size_t skinning_min_chunk_size = 8 * parallel_min_chunk_size;
+
+        template<typename T>
+        [[nodiscard]] inline Matrix4Rows<T> blend_bones(const SkinningJob<T>& job, std::size_t vertex) noexcept
+        {
+            const auto& bones = job.bones[vertex];
+            const auto& weights = job.weights[vertex];
+            Matrix4Rows<T> blended;
+            for (std::size_t row = 0; row < 4; ++row) {
+                auto value = Row4<T>::broadcast(weights[0]) * Row4<T>::load(job.palette[bones[0]][row].data());
+                value = fmadd(Row4<T>::broadcast(weights[1]), Row4<T>::load(job.palette[bones[1]][row].data()), value);
+                value = fmadd(Row4<T>::broadcast(weights[2]), Row4<T>::load(job.palette[bones[2]][row].data()), value);
+                value = fmadd(Row4<T>::broadcast(weights[3]), Row4<T>::load(job.palette[bones[3]][row].data()), value);
+                blended[row] = value;
+            }
+            return blended;
+        }
+
+        template<typename T>
+        [[nodiscard]] inline Vector3_t<T> to_vector3(const Row4<T>& row) noexcept
+        {
+            std::array<T, 4> values;
+            row.store(values.data());
+            return {values[0], values[1], values[2]};
+        }
+
+        inline void check_bone_indices(std::span<const BoneIndices> bones, std::size_t palette_size)
+        {
+            for (const auto& indices : bones) {
+                for (std::size_t i = 0; i < max_bone_influences; ++i) {
+                    if (indices[i] >= palette_size) {
+                        throw std::invalid_argument("bone index must be smaller than the palette size");
+                    }
+                }
+            }
+        }
+
+        // Renormalizes the skinned normals of a batch, rows[lane] holding the
+        // normal of vertex first + lane in its first three lanes. A transpose
+        // puts x, y and z of the batch in one pack each, so the square root and
+        // division run once for skinning_lanes vertices.
+        template<typename T>
+        void store_normals(Matrix4Rows<T> rows, std::span<Vector3_t<T>> normals, std::size_t first, std::size_t count) noexcept
+        {
+            simd::transpose(rows);
+            const auto length_squared = fmadd(rows[2], rows[2], fmadd(rows[1], rows[1], rows[0] * rows[0]));
+            const auto zero = Row4<T>::broadcast(T{0});
+            // A degenerate normal, or one collapsed by the blend, stays zero instead of turning into NaN
+            const auto scale = select(length_squared > zero, Row4<T>::broadcast(T{1}) / sqrt(length_squared), zero);
+            std::array<std::array<T, skinning_lanes>, 3> components;
+            for (std::size_t i = 0; i < 3; ++i) {
+                (rows[i] * scale).store(components[i].data());
+            }
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                normals[first + lane] = {components[0][lane], components[1][lane], components[2][lane]};
+            }
+        }
+
+        // Palette rows are contiguous, so every vertex blends and transforms
+        // whole rows; gathering one matrix component per lane instead takes
+        // twelve scalar loads per bone. The remainder of a range is padded with
+        // its last vertex, so every vertex takes the same path wherever the chunks end.
+        template<typename T>
+        void skin_range(const SkinningJob<T>& job, std::size_t begin, std::size_t end) noexcept
+        {
+            const bool has_normals = !job.normals.empty();
+            for (auto first = begin; first < end; first += skinning_lanes) {
+                const auto count = end - first < skinning_lanes ? end - first : skinning_lanes;
+                Matrix4Rows<T> skinned_normals;
+                for (std::size_t lane = 0; lane < skinning_lanes; ++lane) {
+                    const auto vertex = first + (lane < count ? lane : count - 1);
+                    const auto blended = blend_bones(job, vertex);
+
+                    const auto& position = job.positions[vertex];
+                    auto skinned = fmadd(Row4<T>::broadcast(position[0]), blended[0], blended[3]);
+                    skinned = fmadd(Row4<T>::broadcast(position[1]), blended[1], skinned);
+                    skinned = fmadd(Row4<T>::broadcast(position[2]), blended[2], skinned);
+                    job.skinned_positions[vertex] = to_vector3<T>(skinned);
+
+                    if (has_normals) {
+                        const auto& normal = job.normals[vertex];
+                        auto skinned_normal = Row4<T>::broadcast(normal[0]) * blended[0];
+                        skinned_normal = fmadd(Row4<T>::broadcast(normal[1]), blended[1], skinned_normal);
+                        skinned_normals[lane] = fmadd(Row4<T>::broadcast(normal[2]), blended[2], skinned_normal);
+                    }
+                }
+                if (has_normals) {
+                    store_normals(skinned_normals, job.skinned_normals, first, count);
+                }
+            }
+        }
+    } // namespace detail
+
+    // Linear blend skinning. Each vertex is transformed by the weighted sum of up
+    // to four palette matrices (row vector convention, v * M). Normals are
+    // transformed by the blended linear part and renormalized, which assumes the
+    // palette carries no non-uniform scale; normals that blend to zero length stay
+    // zero. Pass empty normal spans to skip them. Throws std::invalid_argument on
+    // mismatched spans or a bone index outside the palette, before writing any output.
+    // Threads each take at least detail::skinning_min_chunk_size vertices, smaller
+    // meshes are skinned on the calling thread whatever thread_count asks for.
+    template<typename T = float>
+    void skin(std::type_identity_t<std::span<const Vector3_t<T>>> positions,
+              std::type_identity_t<std::span<const Vector3_t<T>>> normals,
+              std::span<const BoneIndices> bones,
+              std::type_identity_t<std::span<const Vector4_t<T>>> weights,
+              std::type_identity_t<std::span<const Matrix4_t<T>>> palette,
+              std::type_identity_t<std::span<Vector3_t<T>>> skinned_positions,
+              std::type_identity_t<std::span<Vector3_t<T>>> skinned_normals,
+              unsigned thread_count = 1)
+    {
+        const auto count = positions.size();
+        if (bones.size() != count || weights.size() != count || skinned_positions.size() != count) {
+            throw std::invalid_argument("skinning spans must have the same size");
+        }
+        if (normals.size() != skinned_normals.size() || (!normals.empty() && normals.size() != count)) {
+            throw std::invalid_argument("skinning normal spans must be empty or match the vertex count");
+        }
+
+        detail::check_bone_indices(bones, palette.size());
+
+        ORION_MATH_INSTRUMENT_BATCH(count);
+        const detail::SkinningJob<T> job{positions, normals, bones, weights, palette, skinned_positions, skinned_normals};
+        parallel_for(count, thread_count, [&job](std::size_t begin, std::size_t end, std::size_t) {
+            detail::skin_range(job, begin, end);
+        }, detail::skinning_min_chunk_size);
+    }
+} // namespace orion::math
@@ -4,6 +4,15 @@
 
 namespace orion
 {
+    // Class types that behave like numbers (half, fixed point) opt in by
+    // specializing this trait.
     template<typename T>
-    concept arithmetic = std::is_arithmetic_v<T>;
-}
+    struct is_arithmetic : std::is_arithmetic<T> {
+    };
+
+    template<typename T>
+    inline constexpr bool is_arithmetic_v = is_arithmetic<T>::value;
+
+    template<typename T>
+    concept arithmetic = is_arithmetic_v<T>;
+} // namespace orion
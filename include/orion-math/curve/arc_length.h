@@ -0,0 +1,102 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "spline.h"
+
+#include <algorithm>   // std::clamp, std::upper_bound
+#include <array>       // std::array
+#include <cmath>       // std::sqrt
+#include <cstddef>     // std::size_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Cumulative arc length of a spline at evenly spaced parameters. Maps a
+    // distance along the curve back to a spline parameter with a binary search
+    // and linear interpolation between the two neighbouring samples, which is
+    // what makes constant speed motion along the curve cheap.
+    template<typename T>
+    class ArcLengthTable
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        static constexpr size_type default_samples_per_segment = 16;
+
+        // Each sample interval is integrated with 5 point Gauss-Legendre
+        // quadrature of the speed |p'(t)|, throws std::invalid_argument for an
+        // empty spline or zero samples per segment
+        template<std::size_t N>
+        explicit ArcLengthTable(const CubicSpline<T, N>& spline, size_type samples_per_segment = default_samples_per_segment)
+        {
+            if (spline.segment_count() == 0 || samples_per_segment == 0) {
+                throw std::invalid_argument("arc length table needs a spline and at least one sample per segment");
+            }
+
+            constexpr std::array<T, 5> nodes{T{0}, static_cast<T>(-.538469310105683091), static_cast<T>(.538469310105683091), static_cast<T>(-.906179845938663993), static_cast<T>(.906179845938663993)};
+            constexpr std::array<T, 5> weights{static_cast<T>(.568888888888888889), static_cast<T>(.478628670499366468), static_cast<T>(.478628670499366468), static_cast<T>(.236926885056189088), static_cast<T>(.236926885056189088)};
+
+            const auto intervals = spline.segment_count() * samples_per_segment;
+            step_ = T{1} / static_cast<T>(samples_per_segment);
+            lengths_.resize(intervals + 1);
+            lengths_[0] = T{0};
+            for (size_type i = 0; i < intervals; ++i) {
+                const auto start = static_cast<T>(i) * step_;
+                T interval{0};
+                for (size_type node = 0; node < nodes.size(); ++node) {
+                    // Gauss nodes lie strictly inside the interval, so every node stays on the interval's segment
+                    const auto t = start + step_ * (nodes[node] + T{1}) / T{2};
+                    interval += weights[node] * std::sqrt(spline.derivative(t).sqr_magnitude());
+                }
+                lengths_[i + 1] = lengths_[i] + interval * step_ / T{2};
+            }
+        }
+
+        [[nodiscard]] T length() const noexcept { return lengths_.back(); }
+        [[nodiscard]] std::span<const T> lengths() const noexcept { return lengths_; }
+
+        // Spline parameter at the given distance from the start, clamped to the curve
+        [[nodiscard]] T parameter_at(T distance) const noexcept
+        {
+            distance = std::clamp(distance, T{0}, length());
+            const auto upper = std::upper_bound(lengths_.begin() + 1, lengths_.end() - 1, distance);
+            const auto index = static_cast<size_type>(upper - lengths_.begin()) - 1;
+            const auto interval = lengths_[index + 1] - lengths_[index];
+            const auto fraction = interval > T{0} ? (distance - lengths_[index]) / interval : T{0};
+            return (static_cast<T>(index) + fraction) * step_;
+        }
+
+    private:
+        T step_{};
+        std::vector<T> lengths_;
+    };
+
+    // result[i] = table.parameter_at(distances[i])
+    template<typename T>
+    void parameters_at(const ArcLengthTable<T>& table, std::type_identity_t<std::span<const T>> distances, std::type_identity_t<std::span<T>> result)
+    {
+        if (distances.size() != result.size()) {
+            throw std::invalid_argument("batch spans must have the same size");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(distances.size());
+        for (std::size_t i = 0; i < distances.size(); ++i) {
+            result[i] = table.parameter_at(distances[i]);
+        }
+    }
+
+    // Fills result with points spaced evenly by arc length from the start to the end of the curve
+    template<typename T, std::size_t N>
+    void evaluate_evenly_spaced(const CubicSpline<T, N>& spline, const std::type_identity_t<ArcLengthTable<T>>& table, std::type_identity_t<std::span<Vector<T, N>>> result)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        const auto count = result.size();
+        const auto spacing = count > 1 ? table.length() / static_cast<T>(count - 1) : T{0};
+        for (std::size_t i = 0; i < count; ++i) {
+            result[i] = spline(table.parameter_at(static_cast<T>(i) * spacing));
+        }
+    }
+} // namespace orion::math
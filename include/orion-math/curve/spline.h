@@ -0,0 +1,272 @@
+#pragma once
+
+#include "orion-math/fma.h"        // fmadd
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for
+#include "orion-math/simd.h"       // simd::Pack
+#include "orion-math/vector/vector.h"
+
+#include <algorithm>   // std::clamp, std::min
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Single cubic segments for t in [0, 1]
+
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> bezier(const Vector<T, N>& p0, const Vector<T, N>& p1, const Vector<T, N>& p2, const Vector<T, N>& p3, T t) noexcept
+    {
+        const auto s = T{1} - t;
+        return p0 * (s * s * s) + p1 * (T{3} * s * s * t) + p2 * (T{3} * s * t * t) + p3 * (t * t * t);
+    }
+
+    // Passes through p0 at t = 0 and p1 at t = 1 with tangents m0 and m1
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> hermite(const Vector<T, N>& p0, const Vector<T, N>& m0, const Vector<T, N>& p1, const Vector<T, N>& m1, T t) noexcept
+    {
+        const auto t2 = t * t;
+        const auto t3 = t2 * t;
+        return p0 * (T{2} * t3 - T{3} * t2 + T{1}) + m0 * (t3 - T{2} * t2 + t) + p1 * (T{3} * t2 - T{2} * t3) + m1 * (t3 - t2);
+    }
+
+    // Uniform Catmull-Rom segment between p1 and p2
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> catmull_rom(const Vector<T, N>& p0, const Vector<T, N>& p1, const Vector<T, N>& p2, const Vector<T, N>& p3, T t) noexcept
+    {
+        return hermite(p1, (p2 - p0) * T{.5}, p2, (p3 - p1) * T{.5}, t);
+    }
+
+    // Uniform cubic B-spline segment, which approximates rather than
+    // interpolates its control points
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> bspline(const Vector<T, N>& p0, const Vector<T, N>& p1, const Vector<T, N>& p2, const Vector<T, N>& p3, T t) noexcept
+    {
+        const auto s = T{1} - t;
+        const auto t2 = t * t;
+        const auto t3 = t2 * t;
+        return (p0 * (s * s * s) + p1 * (T{3} * t3 - T{6} * t2 + T{4}) + p2 * (T{-3} * t3 + T{3} * t2 + T{3} * t + T{1}) + p3 * t3) / T{6};
+    }
+
+    // Piecewise cubic curve stored as power basis coefficients per segment, so
+    // every curve type evaluates the same way: p(u) = c0 + c1 u + c2 u^2 + c3 u^3.
+    // The global parameter t runs over [0, segment_count()], segment i covering [i, i + 1].
+    template<typename T, std::size_t N>
+    class CubicSpline
+    {
+    public:
+        using value_type = T;
+        using point_type = Vector<T, N>;
+        using segment_type = std::array<point_type, 4>;
+        using size_type = std::size_t;
+
+        CubicSpline() = default;
+
+        // Throws std::invalid_argument when there is no segment
+        explicit CubicSpline(std::vector<segment_type> segments)
+            : segments_(std::move(segments))
+        {
+            if (segments_.empty()) {
+                throw std::invalid_argument("spline needs at least one segment");
+            }
+        }
+
+        // 3k + 1 control points, consecutive segments share their end point
+        [[nodiscard]] static CubicSpline bezier(std::span<const point_type> control)
+        {
+            if (control.size() < 4 || (control.size() - 1) % 3 != 0) {
+                throw std::invalid_argument("Bezier spline needs 3k + 1 control points");
+            }
+            std::vector<segment_type> segments((control.size() - 1) / 3);
+            for (size_type i = 0; i < segments.size(); ++i) {
+                const auto& p0 = control[i * 3];
+                const auto& p1 = control[i * 3 + 1];
+                const auto& p2 = control[i * 3 + 2];
+                const auto& p3 = control[i * 3 + 3];
+                segments[i] = {p0, (p1 - p0) * T{3}, (p0 - p1 * T{2} + p2) * T{3}, p3 - p0 + (p1 - p2) * T{3}};
+            }
+            return CubicSpline{std::move(segments)};
+        }
+
+        // Interpolates points with the given tangents
+        [[nodiscard]] static CubicSpline hermite(std::span<const point_type> points, std::span<const point_type> tangents)
+        {
+            if (points.size() < 2 || points.size() != tangents.size()) {
+                throw std::invalid_argument("Hermite spline needs at least two points and one tangent per point");
+            }
+            std::vector<segment_type> segments(points.size() - 1);
+            for (size_type i = 0; i < segments.size(); ++i) {
+                segments[i] = hermite_segment(points[i], tangents[i], points[i + 1], tangents[i + 1]);
+            }
+            return CubicSpline{std::move(segments)};
+        }
+
+        // Interpolates points[1] to points[n - 2], the outer points only shape the end tangents
+        [[nodiscard]] static CubicSpline catmull_rom(std::span<const point_type> points)
+        {
+            if (points.size() < 4) {
+                throw std::invalid_argument("Catmull-Rom spline needs at least four points");
+            }
+            std::vector<segment_type> segments(points.size() - 3);
+            for (size_type i = 0; i < segments.size(); ++i) {
+                segments[i] = hermite_segment(points[i + 1], (points[i + 2] - points[i]) * T{.5}, points[i + 2], (points[i + 3] - points[i + 1]) * T{.5});
+            }
+            return CubicSpline{std::move(segments)};
+        }
+
+        // Uniform cubic B-spline, C2 continuous
+        [[nodiscard]] static CubicSpline bspline(std::span<const point_type> control)
+        {
+            if (control.size() < 4) {
+                throw std::invalid_argument("B-spline needs at least four control points");
+            }
+            std::vector<segment_type> segments(control.size() - 3);
+            for (size_type i = 0; i < segments.size(); ++i) {
+                const auto& p0 = control[i];
+                const auto& p1 = control[i + 1];
+                const auto& p2 = control[i + 2];
+                const auto& p3 = control[i + 3];
+                segments[i] = {(p0 + p1 * T{4} + p2) / T{6}, (p2 - p0) / T{2}, (p0 - p1 * T{2} + p2) / T{2}, (p3 - p0 + (p1 - p2) * T{3}) / T{6}};
+            }
+            return CubicSpline{std::move(segments)};
+        }
+
+        [[nodiscard]] size_type segment_count() const noexcept { return segments_.size(); }
+        [[nodiscard]] std::span<const segment_type> segments() const noexcept { return segments_; }
+
+        // Segment containing t, parameters outside the curve clamp to the first or last segment
+        [[nodiscard]] size_type segment_of(T t) const noexcept
+        {
+            const auto last = static_cast<T>(segments_.size() - 1);
+            return static_cast<size_type>(std::clamp(t, T{0}, last));
+        }
+
+        [[nodiscard]] point_type operator()(T t) const noexcept
+        {
+            const auto segment = segment_of(t);
+            const auto u = t - static_cast<T>(segment);
+            const auto& c = segments_[segment];
+            point_type result;
+            for (size_type i = 0; i < N; ++i) {
+                result[i] = fmadd(fmadd(fmadd(c[3][i], u, c[2][i]), u, c[1][i]), u, c[0][i]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] point_type derivative(T t) const noexcept
+        {
+            const auto segment = segment_of(t);
+            const auto u = t - static_cast<T>(segment);
+            const auto& c = segments_[segment];
+            point_type result;
+            for (size_type i = 0; i < N; ++i) {
+                result[i] = fmadd(fmadd(T{3} * c[3][i], u, T{2} * c[2][i]), u, c[1][i]);
+            }
+            return result;
+        }
+
+    private:
+        [[nodiscard]] static segment_type hermite_segment(const point_type& p0, const point_type& m0, const point_type& p1, const point_type& m1) noexcept
+        {
+            return {p0, m0, (p1 - p0) * T{3} - m0 * T{2} - m1, (p0 - p1) * T{2} + m0 + m1};
+        }
+
+        std::vector<segment_type> segments_;
+    };
+
+    // result[i] = spline(parameters[i]). Four parameters are evaluated per
+    // iteration with their segment coefficients gathered into packs.
+    template<typename T, std::size_t N>
+    void evaluate(const CubicSpline<T, N>& spline,
+                  std::type_identity_t<std::span<const T>> parameters,
+                  std::type_identity_t<std::span<Vector<T, N>>> result,
+                  unsigned thread_count = 1)
+    {
+        if (parameters.size() != result.size()) {
+            throw std::invalid_argument("batch spans must have the same size");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(parameters.size());
+
+        using Pack = simd::Pack<T, 4>;
+        const auto segments = spline.segments();
+        parallel_for(parameters.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            auto i = begin;
+            for (; i + Pack::lanes <= end; i += Pack::lanes) {
+                std::array<std::size_t, Pack::lanes> segment{};
+                std::array<T, Pack::lanes> u{};
+                for (std::size_t lane = 0; lane < Pack::lanes; ++lane) {
+                    segment[lane] = spline.segment_of(parameters[i + lane]);
+                    u[lane] = parameters[i + lane] - static_cast<T>(segment[lane]);
+                }
+                const auto u_pack = Pack::load(u.data());
+                for (std::size_t component = 0; component < N; ++component) {
+                    std::array<std::array<T, Pack::lanes>, 4> coefficients{};
+                    for (std::size_t lane = 0; lane < Pack::lanes; ++lane) {
+                        for (std::size_t power = 0; power < 4; ++power) {
+                            coefficients[power][lane] = segments[segment[lane]][power][component];
+                        }
+                    }
+                    auto value = fmadd(Pack::load(coefficients[3].data()), u_pack, Pack::load(coefficients[2].data()));
+                    value = fmadd(value, u_pack, Pack::load(coefficients[1].data()));
+                    value = fmadd(value, u_pack, Pack::load(coefficients[0].data()));
+                    for (std::size_t lane = 0; lane < Pack::lanes; ++lane) {
+                        result[i + lane][component] = value[lane];
+                    }
+                }
+            }
+            for (; i < end; ++i) {
+                result[i] = spline(parameters[i]);
+            }
+        });
+    }
+
+    // Samples result.size() evenly spaced parameters from first to last,
+    // both included. Within a segment each sample is three additions away from
+    // the previous one by forward differencing; the differences are restarted
+    // from the exact polynomial at every segment and chunk boundary, which
+    // keeps the accumulated rounding error bounded.
+    template<typename T, std::size_t N>
+    void evaluate_uniform(const CubicSpline<T, N>& spline,
+                          std::type_identity_t<T> first,
+                          std::type_identity_t<T> last,
+                          std::type_identity_t<std::span<Vector<T, N>>> result,
+                          unsigned thread_count = 1)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(result.size());
+        const auto count = result.size();
+        const auto step = count > 1 ? (last - first) / static_cast<T>(count - 1) : T{0};
+        auto parameter = [&](std::size_t i) { return first + static_cast<T>(i) * step; };
+
+        const auto segments = spline.segments();
+        parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            auto i = begin;
+            while (i < end) {
+                const auto t = parameter(i);
+                const auto segment = spline.segment_of(t);
+                const auto u = t - static_cast<T>(segment);
+                const auto& c = segments[segment];
+
+                const auto h = step;
+                const auto h2 = h * h;
+                const auto h3 = h2 * h;
+                auto value = spline(t);
+                auto first_difference = c[1] * h + c[2] * (T{2} * u * h + h2) + c[3] * (T{3} * u * u * h + T{3} * u * h2 + h3);
+                auto second_difference = c[2] * (T{2} * h2) + c[3] * (T{6} * u * h2 + T{6} * h3);
+                const auto third_difference = c[3] * (T{6} * h3);
+
+                result[i++] = value;
+                while (i < end && spline.segment_of(parameter(i)) == segment) {
+                    value = value + first_difference;
+                    first_difference = first_difference + second_difference;
+                    second_difference = second_difference + third_difference;
+                    result[i++] = value;
+                }
+            }
+        });
+    }
+} // namespace orion::math
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "orion-math/matrix/matrix4.h"
+#include "orion-math/vector/vector3.h"
+
+#include <optional>    // std::optional
+#include <span>        // std::span
+#include <string_view> // std::string_view
+
+// Batch kernels of the orion_math_dispatch companion library. Unlike the
+// header-only library, these are compiled once per instruction set and the
+// best one the host supports is selected the first time a kernel runs.
+namespace orion::math::dispatch
+{
+    // Ordered from least to most capable
+    enum class Isa {
+        // Whatever the consumer's compiler flags target
+        baseline,
+        sse42,
+        avx2,
+        avx512,
+    };
+
+    [[nodiscard]] std::string_view to_string(Isa isa) noexcept;
+    [[nodiscard]] std::optional<Isa> parse_isa(std::string_view name) noexcept;
+
+    // Most capable instruction set that was both compiled in and is supported by the host
+    [[nodiscard]] Isa detected_isa() noexcept;
+
+    // Instruction set the kernels currently run with. Initialized to
+    // detected_isa(), or to the value of the ORION_MATH_ISA environment
+    // variable when it names a usable instruction set.
+    [[nodiscard]] Isa active_isa() noexcept;
+
+    // Forces the kernels onto an instruction set, throws std::invalid_argument
+    // when it is not usable on this host
+    void force_isa(Isa isa);
+
+    // result[i] = transform(points[i], matrix), result may alias points
+    void transform_points(std::span<const Vector3_f> points, const Matrix4_f& matrix, std::span<Vector3_f> result);
+
+    // Normalizes every vector in place
+    void normalize(std::span<Vector3_f> vectors);
+
+    // result[i] = dot(lhs[i], rhs[i])
+    void dot(std::span<const Vector3_f> lhs, std::span<const Vector3_f> rhs, std::span<float> result);
+} // namespace orion::math::dispatch
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "concepts.h" // is_arithmetic
+#include "sqrt.h"     // isqrt
+
+#include <compare>     // std::strong_ordering
+#include <concepts>    // std::integral, std::floating_point
+#include <cstdint>     // std::int32_t, std::int64_t, std::uint32_t
+#include <type_traits> // std::true_type
+
+namespace orion::math
+{
+    // Signed two's complement fixed point number with IntBits integer bits
+    // (sign included) and FracBits fractional bits. All operations are integer
+    // only, so results are bit identical across compilers and platforms.
+    // Multiplication and division truncate towards negative infinity and zero respectively.
+    template<int IntBits, int FracBits>
+    class Fixed
+    {
+        static_assert(IntBits > 0 && FracBits >= 0, "fixed point needs a sign bit");
+        static_assert(IntBits + FracBits <= 32, "fixed point storage is limited to 32 bits");
+
+    public:
+        using storage = std::int32_t;
+        using unsigned_storage = std::uint32_t;
+        // Intermediate type for products and quotients
+        using wide = std::int64_t;
+
+        static constexpr int integer_bits = IntBits;
+        static constexpr int fractional_bits = FracBits;
+        static constexpr wide one = wide{1} << FracBits;
+
+        constexpr Fixed() = default;
+
+        template<std::integral Integral>
+        constexpr explicit Fixed(Integral value) noexcept
+            : raw_(static_cast<storage>(static_cast<wide>(value) * one))
+        {
+        }
+
+        // Rounds to the nearest representable value
+        template<std::floating_point Floating>
+        constexpr explicit Fixed(Floating value) noexcept
+            : raw_(static_cast<storage>(static_cast<double>(value) * static_cast<double>(one) + (value < 0 ? -0.5 : 0.5)))
+        {
+        }
+
+        [[nodiscard]] static constexpr Fixed from_raw(storage raw) noexcept
+        {
+            Fixed result;
+            result.raw_ = raw;
+            return result;
+        }
+
+        [[nodiscard]] constexpr storage raw() const noexcept { return raw_; }
+
+        template<std::floating_point Floating>
+        [[nodiscard]] constexpr explicit operator Floating() const noexcept
+        {
+            return static_cast<Floating>(raw_) / static_cast<Floating>(one);
+        }
+
+        // Rounds towards negative infinity
+        template<std::integral Integral>
+        [[nodiscard]] constexpr explicit operator Integral() const noexcept
+        {
+            return static_cast<Integral>(raw_ >> FracBits);
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(Fixed lhs, Fixed rhs) noexcept = default;
+        [[nodiscard]] constexpr friend std::strong_ordering operator<=>(Fixed lhs, Fixed rhs) noexcept = default;
+
+        // Addition, subtraction and negation wrap around on overflow like the
+        // underlying two's complement integers, identically on every platform
+        [[nodiscard]] constexpr Fixed operator-() const noexcept { return from_raw(static_cast<storage>(-static_cast<unsigned_storage>(raw_))); }
+
+        [[nodiscard]] constexpr friend Fixed operator+(Fixed lhs, Fixed rhs) noexcept
+        {
+            return from_raw(static_cast<storage>(static_cast<unsigned_storage>(lhs.raw_) + static_cast<unsigned_storage>(rhs.raw_)));
+        }
+        [[nodiscard]] constexpr friend Fixed operator-(Fixed lhs, Fixed rhs) noexcept
+        {
+            return from_raw(static_cast<storage>(static_cast<unsigned_storage>(lhs.raw_) - static_cast<unsigned_storage>(rhs.raw_)));
+        }
+        [[nodiscard]] constexpr friend Fixed operator*(Fixed lhs, Fixed rhs) noexcept
+        {
+            return from_raw(static_cast<storage>((static_cast<wide>(lhs.raw_) * rhs.raw_) >> FracBits));
+        }
+        // rhs must not be zero
+        [[nodiscard]] constexpr friend Fixed operator/(Fixed lhs, Fixed rhs) noexcept
+        {
+            return from_raw(static_cast<storage>((static_cast<wide>(lhs.raw_) * one) / rhs.raw_));
+        }
+
+        constexpr Fixed& operator+=(Fixed other) noexcept { return *this = *this + other; }
+        constexpr Fixed& operator-=(Fixed other) noexcept { return *this = *this - other; }
+        constexpr Fixed& operator*=(Fixed other) noexcept { return *this = *this * other; }
+        constexpr Fixed& operator/=(Fixed other) noexcept { return *this = *this / other; }
+
+    private:
+        storage raw_ = 0;
+    };
+
+    template<int IntBits, int FracBits>
+    [[nodiscard]] constexpr Fixed<IntBits, FracBits> abs(Fixed<IntBits, FracBits> value) noexcept
+    {
+        return value.raw() < 0 ? -value : value;
+    }
+
+    // Square root through the integer square root of the value scaled by 2^FracBits
+    template<int IntBits, int FracBits>
+    [[nodiscard]] constexpr Fixed<IntBits, FracBits> sqrt(Fixed<IntBits, FracBits> value) noexcept
+    {
+        using fixed = Fixed<IntBits, FracBits>;
+        using storage = typename fixed::storage;
+        using wide = typename fixed::wide;
+        return fixed::from_raw(static_cast<storage>(isqrt(static_cast<wide>(value.raw()) << FracBits)));
+    }
+
+    using Fixed16_16 = Fixed<16, 16>;
+    using Fixed24_8 = Fixed<24, 8>;
+} // namespace orion::math
+
+template<int IntBits, int FracBits>
+struct orion::is_arithmetic<orion::math::Fixed<IntBits, FracBits>> : std::true_type {
+};
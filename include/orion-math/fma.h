@@ -0,0 +1,50 @@
+#pragma once
+
+#include "target.h" // ORION_MATH_FMA
+
+#include <cmath>       // std::fma
+#include <concepts>    // std::floating_point
+#include <type_traits> // std::is_constant_evaluated
+
+namespace orion::math
+{
+    // Computes lhs * rhs + addend. Floating point values go through std::fma,
+    // which compiles to a single fused instruction when the target has
+    // hardware FMA. Without it std::fma is a slow library call, so the plain
+    // multiply-add is kept unless ORION_MATH_PRECISE_FMA asks for the fused
+    // rounding regardless of cost.
+    template<typename T>
+    [[nodiscard]] constexpr T fmadd(T lhs, T rhs, T addend) noexcept
+    {
+#if defined(ORION_MATH_FMA) || defined(ORION_MATH_PRECISE_FMA)
+        if constexpr (std::floating_point<T>) {
+            if (!std::is_constant_evaluated()) {
+                return std::fma(lhs, rhs, addend);
+            }
+        }
+#endif
+        return lhs * rhs + addend;
+    }
+
+    // Computes a * b - c * d as fmadd(a, b, -(c * d)), one instruction fewer
+    // than the plain form with hardware FMA. Only c * d is rounded, so with
+    // fused fmadd swapping the products need not negate the result exactly and
+    // equal products leave a residue of one rounding error.
+    // ORION_MATH_PRECISE_FMA instead differences the rounded products and their
+    // fmadd-recovered rounding errors separately, which makes equal products
+    // cancel and swapped ones negate exactly. That costs two more fused
+    // multiply-adds and three more additions, and infinite products give NaN.
+    template<typename T>
+    [[nodiscard]] constexpr T difference_of_products(T a, T b, T c, T d) noexcept
+    {
+#if defined(ORION_MATH_PRECISE_FMA)
+        const T ab = a * b;
+        const T cd = c * d;
+        const T ab_error = fmadd(a, b, static_cast<T>(-ab));
+        const T cd_error = fmadd(c, d, static_cast<T>(-cd));
+        return static_cast<T>((ab - cd) + (ab_error - cd_error));
+#else
+        return fmadd(a, b, static_cast<T>(-(c * d)));
+#endif
+    }
+} // namespace orion::math
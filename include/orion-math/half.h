@@ -0,0 +1,130 @@
+#pragma once
+
+#include "concepts.h" // is_arithmetic
+#include "target.h"   // ORION_MATH_F16C
+
+#include <bit>         // std::bit_cast
+#include <cstdint>     // std::uint16_t, std::uint32_t
+#include <type_traits> // std::true_type, std::is_constant_evaluated
+
+#if defined(ORION_MATH_F16C)
+    #include <immintrin.h> // _cvtsh_ss, _cvtss_sh
+#endif
+
+namespace orion::math
+{
+    namespace detail
+    {
+        // Round to nearest even, overflow to infinity, NaN stays (quiet) NaN.
+        [[nodiscard]] constexpr std::uint16_t float_to_half_bits(float value) noexcept
+        {
+            constexpr std::uint32_t float_infinity = 255U << 23U;
+            constexpr std::uint32_t half_overflow = (127U + 16U) << 23U;
+            constexpr std::uint32_t smallest_normal = 113U << 23U;
+            constexpr std::uint32_t denormal_magic = ((127U - 15U) + (23U - 10U) + 1U) << 23U;
+
+            auto bits = std::bit_cast<std::uint32_t>(value);
+            const auto sign = bits & 0x8000'0000U;
+            bits ^= sign;
+
+            std::uint32_t result = 0;
+            if (bits >= half_overflow) {
+                result = bits > float_infinity ? 0x7e00U : 0x7c00U;
+            } else if (bits < smallest_normal) {
+                // Let the float adder align and round the mantissa for us
+                const auto aligned = std::bit_cast<float>(bits) + std::bit_cast<float>(denormal_magic);
+                result = std::bit_cast<std::uint32_t>(aligned) - denormal_magic;
+            } else {
+                const auto mantissa_odd = (bits >> 13U) & 1U;
+                bits += ((15U - 127U) << 23U) + 0xfffU;
+                bits += mantissa_odd;
+                result = bits >> 13U;
+            }
+            return static_cast<std::uint16_t>(result | (sign >> 16U));
+        }
+
+        [[nodiscard]] constexpr float half_bits_to_float(std::uint16_t value) noexcept
+        {
+            constexpr std::uint32_t shifted_exponent = 0x7c00U << 13U;
+            constexpr std::uint32_t magic = 113U << 23U;
+
+            auto bits = (static_cast<std::uint32_t>(value) & 0x7fffU) << 13U;
+            const auto exponent = bits & shifted_exponent;
+            bits += (127U - 15U) << 23U;
+
+            if (exponent == shifted_exponent) {
+                bits += (128U - 16U) << 23U;
+            } else if (exponent == 0) {
+                bits += 1U << 23U;
+                bits = std::bit_cast<std::uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(magic));
+            }
+            bits |= (static_cast<std::uint32_t>(value) & 0x8000U) << 16U;
+            return std::bit_cast<float>(bits);
+        }
+    } // namespace detail
+
+    // IEEE 754 binary16 storage type. Arithmetic is carried out in float and
+    // rounded back, so half is meant for storage and bandwidth, not for math.
+    class half
+    {
+    public:
+        constexpr half() = default;
+
+        constexpr explicit half(float value) noexcept
+            : bits_(from_float(value))
+        {
+        }
+
+        [[nodiscard]] static constexpr half from_bits(std::uint16_t bits) noexcept
+        {
+            half result;
+            result.bits_ = bits;
+            return result;
+        }
+
+        [[nodiscard]] constexpr std::uint16_t bits() const noexcept { return bits_; }
+
+        [[nodiscard]] constexpr operator float() const noexcept // NOLINT(google-explicit-constructor)
+        {
+            if (std::is_constant_evaluated()) {
+                return detail::half_bits_to_float(bits_);
+            }
+#if defined(ORION_MATH_F16C)
+            return _cvtsh_ss(bits_);
+#else
+            return detail::half_bits_to_float(bits_);
+#endif
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(half lhs, half rhs) noexcept
+        {
+            return static_cast<float>(lhs) == static_cast<float>(rhs);
+        }
+
+        [[nodiscard]] constexpr friend half operator+(half lhs, half rhs) noexcept { return half{static_cast<float>(lhs) + static_cast<float>(rhs)}; }
+        [[nodiscard]] constexpr friend half operator-(half lhs, half rhs) noexcept { return half{static_cast<float>(lhs) - static_cast<float>(rhs)}; }
+        [[nodiscard]] constexpr friend half operator*(half lhs, half rhs) noexcept { return half{static_cast<float>(lhs) * static_cast<float>(rhs)}; }
+        [[nodiscard]] constexpr friend half operator/(half lhs, half rhs) noexcept { return half{static_cast<float>(lhs) / static_cast<float>(rhs)}; }
+
+        [[nodiscard]] constexpr half operator-() const noexcept { return from_bits(static_cast<std::uint16_t>(bits_ ^ 0x8000U)); }
+
+    private:
+        [[nodiscard]] static constexpr std::uint16_t from_float(float value) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return detail::float_to_half_bits(value);
+            }
+#if defined(ORION_MATH_F16C)
+            return _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+            return detail::float_to_half_bits(value);
+#endif
+        }
+
+        std::uint16_t bits_ = 0;
+    };
+} // namespace orion::math
+
+template<>
+struct orion::is_arithmetic<orion::math::half> : std::true_type {
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <type_traits> // std::is_constant_evaluated
+
+#if defined(ORION_MATH_INSTRUMENT)
+    #include <chrono> // std::chrono::steady_clock
+#endif
+
+namespace orion::math::instrument
+{
+    enum class Counter : std::size_t {
+        matrix_multiply,
+        transform,
+        normalize,
+        sqrt,
+        sqrt_iteration,
+        sin,
+        cos,
+        batch_call,
+        batch_element,
+    };
+
+    inline constexpr std::size_t counter_count = static_cast<std::size_t>(Counter::batch_element) + 1;
+
+    // True when the library was compiled with ORION_MATH_INSTRUMENT. Without it
+    // every hook compiles away and snapshots stay zero.
+#if defined(ORION_MATH_INSTRUMENT)
+    inline constexpr bool enabled = true;
+#else
+    inline constexpr bool enabled = false;
+#endif
+
+    struct Snapshot {
+        std::array<std::uint64_t, counter_count> counts{};
+        // Only filled by timing scopes, see ORION_MATH_INSTRUMENT_TIMING
+        std::array<std::uint64_t, counter_count> nanoseconds{};
+
+        [[nodiscard]] constexpr std::uint64_t count(Counter counter) const noexcept { return counts[static_cast<std::size_t>(counter)]; }
+        [[nodiscard]] constexpr std::uint64_t elapsed_ns(Counter counter) const noexcept { return nanoseconds[static_cast<std::size_t>(counter)]; }
+    };
+
+#if defined(ORION_MATH_INSTRUMENT)
+    namespace detail
+    {
+        inline thread_local Snapshot thread_counters{};
+
+        inline void add(Counter counter, std::uint64_t amount) noexcept
+        {
+            thread_counters.counts[static_cast<std::size_t>(counter)] += amount;
+        }
+    } // namespace detail
+
+    // Accumulates the lifetime of the scope into the nanoseconds of a counter
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Counter counter) noexcept
+            : counter_(counter)
+            , start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+        ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+        ~ScopedTimer()
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            detail::thread_counters.nanoseconds[static_cast<std::size_t>(counter_)] += static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+    private:
+        Counter counter_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    // Counts one batch call and its elements, then times the call until destruction
+    class BatchScope
+    {
+    public:
+        explicit BatchScope(std::uint64_t elements) noexcept
+            : timer_(Counter::batch_call)
+        {
+            detail::add(Counter::batch_call, 1);
+            detail::add(Counter::batch_element, elements);
+        }
+
+    private:
+        ScopedTimer timer_;
+    };
+#endif
+
+    // Counters of the calling thread
+    [[nodiscard]] inline Snapshot snapshot() noexcept
+    {
+#if defined(ORION_MATH_INSTRUMENT)
+        return detail::thread_counters;
+#else
+        return {};
+#endif
+    }
+
+    inline void reset() noexcept
+    {
+#if defined(ORION_MATH_INSTRUMENT)
+        detail::thread_counters = {};
+#endif
+    }
+} // namespace orion::math::instrument
+
+// Hooks are safe inside constexpr functions, constant evaluation skips them
+#if defined(ORION_MATH_INSTRUMENT)
+    #define ORION_MATH_COUNT_N(counter, amount)                                                                   \
+        do {                                                                                                      \
+            if (!std::is_constant_evaluated()) {                                                                  \
+                ::orion::math::instrument::detail::add(::orion::math::instrument::Counter::counter, (amount));    \
+            }                                                                                                     \
+        } while (false)
+#else
+    #define ORION_MATH_COUNT_N(counter, amount) static_cast<void>(0)
+#endif
+
+#define ORION_MATH_COUNT(counter) ORION_MATH_COUNT_N(counter, 1)
+
+// Timing scopes read the clock twice per call, so they need ORION_MATH_INSTRUMENT_TIMING
+// on top of ORION_MATH_INSTRUMENT and are only placed in non-constexpr batch kernels
+#if defined(ORION_MATH_INSTRUMENT) && defined(ORION_MATH_INSTRUMENT_TIMING)
+    #define ORION_MATH_TIMED_SCOPE(counter) \
+        const ::orion::math::instrument::ScopedTimer orion_math_timed_scope_##counter { ::orion::math::instrument::Counter::counter }
+#else
+    #define ORION_MATH_TIMED_SCOPE(counter) static_cast<void>(0)
+#endif
+
+// Counts one batch call with its element count. Expands to a single statement,
+// so it is safe as the body of an unbraced if. With timing enabled that statement
+// declares a scope object timing until the end of the enclosing block, so place
+// it at the top of the block it measures.
+#if defined(ORION_MATH_INSTRUMENT) && defined(ORION_MATH_INSTRUMENT_TIMING)
+    #define ORION_MATH_INSTRUMENT_BATCH(elements) \
+        const ::orion::math::instrument::BatchScope orion_math_batch_scope { static_cast<std::uint64_t>(elements) }
+#else
+    #define ORION_MATH_INSTRUMENT_BATCH(elements)          \
+        do {                                               \
+            ORION_MATH_COUNT(batch_call);                  \
+            ORION_MATH_COUNT_N(batch_element, (elements)); \
+        } while (false)
+#endif
@@ -0,0 +1,408 @@
+#pragma once
+
+#include "batch.h"                 // detail::check_batch_sizes
+#include "matrix.h"                // detail::static_for
+#include "matrix3.h"
+#include "matrix4.h"
+#include "orion-math/fma.h"        // fmadd
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for, parallel_min_chunk_size
+#include "orion-math/simd.h"       // simd::Pack
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument, std::out_of_range
+#include <type_traits> // std::is_same_v, std::type_identity_t
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Problems processed by one instruction: 8 floats fill an AVX register and
+    // two SSE registers, doubles take two AVX registers
+    inline constexpr std::size_t aosoa_lanes = 8;
+
+    template<typename T>
+    using AosoaLanes = std::array<T, aosoa_lanes>;
+
+    namespace detail
+    {
+        // Flattens a value into scalar components and names the value unused lanes are padded with
+        template<typename Value>
+        struct AosoaTraits;
+
+        template<typename T, std::size_t N>
+        struct AosoaTraits<Vector<T, N>> {
+            using scalar_type = T;
+            static constexpr std::size_t components = N;
+
+            [[nodiscard]] static constexpr T& component(Vector<T, N>& value, std::size_t index) noexcept { return value[index]; }
+            [[nodiscard]] static constexpr const T& component(const Vector<T, N>& value, std::size_t index) noexcept { return value[index]; }
+            [[nodiscard]] static constexpr Vector<T, N> padding() noexcept { return {}; }
+        };
+
+        // Row-major, so component row * Cols + column is element [row][column]
+        template<typename T, std::size_t Rows, std::size_t Cols>
+        struct AosoaTraits<Matrix<T, Rows, Cols>> {
+            using scalar_type = T;
+            static constexpr std::size_t components = Rows * Cols;
+
+            [[nodiscard]] static constexpr T& component(Matrix<T, Rows, Cols>& value, std::size_t index) noexcept { return value[index / Cols][index % Cols]; }
+            [[nodiscard]] static constexpr const T& component(const Matrix<T, Rows, Cols>& value, std::size_t index) noexcept { return value[index / Cols][index % Cols]; }
+
+            // Identity keeps inverse and solve finite in the lanes past the end of a batch
+            [[nodiscard]] static constexpr Matrix<T, Rows, Cols> padding() noexcept
+            {
+                if constexpr (Rows == Cols) {
+                    return Matrix<T, Rows, Cols>::identity();
+                } else {
+                    return {};
+                }
+            }
+        };
+    } // namespace detail
+
+    // aosoa_lanes values with each scalar component stored contiguously across
+    // the lanes, so component c of all of them loads as one SIMD register
+    template<typename Value>
+    struct alignas(32) AosoaBlock {
+        using scalar_type = typename detail::AosoaTraits<Value>::scalar_type;
+
+        std::array<AosoaLanes<scalar_type>, detail::AosoaTraits<Value>::components> components;
+
+        [[nodiscard]] constexpr AosoaLanes<scalar_type>& operator[](std::size_t component) noexcept { return components[component]; }
+        [[nodiscard]] constexpr const AosoaLanes<scalar_type>& operator[](std::size_t component) const noexcept { return components[component]; }
+    };
+
+    // Array of structures of arrays: a sequence of AosoaBlock holding size()
+    // values, the lanes after the last value padded with identity matrices or zero vectors
+    template<typename Value>
+    class AosoaBatch
+    {
+    public:
+        using value_type = Value;
+        using block_type = AosoaBlock<Value>;
+        using traits = detail::AosoaTraits<Value>;
+
+        AosoaBatch() = default;
+
+        explicit AosoaBatch(std::size_t size)
+            : blocks_((size + aosoa_lanes - 1) / aosoa_lanes)
+            , size_(size)
+        {
+            for (auto& block : blocks_) {
+                fill_block(block, traits::padding());
+            }
+        }
+
+        explicit AosoaBatch(std::span<const Value> values)
+            : AosoaBatch(values.size())
+        {
+            pack(values);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] std::span<block_type> blocks() noexcept { return blocks_; }
+        [[nodiscard]] std::span<const block_type> blocks() const noexcept { return blocks_; }
+
+        [[nodiscard]] Value operator[](std::size_t index) const noexcept
+        {
+            const auto& block = blocks_[index / aosoa_lanes];
+            const auto lane = index % aosoa_lanes;
+            Value value{};
+            for (std::size_t component = 0; component < traits::components; ++component) {
+                traits::component(value, component) = block[component][lane];
+            }
+            return value;
+        }
+
+        void set(std::size_t index, const Value& value)
+        {
+            if (index >= size_) {
+                throw std::out_of_range("index out of range of batch");
+            }
+            auto& block = blocks_[index / aosoa_lanes];
+            const auto lane = index % aosoa_lanes;
+            for (std::size_t component = 0; component < traits::components; ++component) {
+                block[component][lane] = traits::component(value, component);
+            }
+        }
+
+        // Replaces the contents with values, resizing the batch to match
+        void pack(std::span<const Value> values)
+        {
+            if (values.size() != size_) {
+                *this = AosoaBatch(values.size());
+            }
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                set(i, values[i]);
+            }
+        }
+
+        void unpack(std::span<Value> values) const
+        {
+            if (values.size() != size_) {
+                throw std::invalid_argument("batch spans must have the same size");
+            }
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                values[i] = (*this)[i];
+            }
+        }
+
+    private:
+        static void fill_block(block_type& block, const Value& value) noexcept
+        {
+            for (std::size_t component = 0; component < traits::components; ++component) {
+                block[component].fill(traits::component(value, component));
+            }
+        }
+
+        std::vector<block_type> blocks_;
+        std::size_t size_ = 0;
+    };
+
+    template<typename T, std::size_t N>
+    using MatrixBatch = AosoaBatch<Matrix<T, N, N>>;
+
+    template<typename T, std::size_t N>
+    using VectorBatch = AosoaBatch<Vector<T, N>>;
+
+    using Matrix3Batch = MatrixBatch<float, 3>;
+    using Matrix4Batch = MatrixBatch<float, 4>;
+    using Vector3Batch = VectorBatch<float, 3>;
+    using Vector4Batch = VectorBatch<float, 4>;
+
+    namespace detail
+    {
+        // Blocks handed to one thread at least, the same number of values as other batch kernels
+        inline constexpr std::size_t aosoa_min_chunk_blocks = parallel_min_chunk_size / aosoa_lanes;
+
+        // Widest native pack that divides a block. Under AVX floats take all 8
+        // lanes in one register; otherwise floats use two SSE packs of 4. Doubles
+        // always use two packs of 4, native under AVX. A generic 8 lane pack
+        // would cover the block in one step but runs up to 4x slower than two native ones.
+#if defined(ORION_MATH_AVX)
+        template<typename T>
+        inline constexpr std::size_t aosoa_pack_lanes = std::is_same_v<T, float> ? aosoa_lanes : 4;
+#else
+        template<typename T>
+        inline constexpr std::size_t aosoa_pack_lanes = 4;
+#endif
+
+        template<typename T>
+        using AosoaPack = simd::Pack<T, aosoa_pack_lanes<T>>;
+
+        // The kernels below run over a block one pack of lanes at a time. Every
+        // load is a unit stride read of one component across lanes, so each scalar
+        // operation of the math becomes one instruction for AosoaPack::lanes problems.
+        template<typename T, typename Function>
+        inline void for_each_pack(Function&& function) noexcept
+        {
+            for (std::size_t offset = 0; offset < aosoa_lanes; offset += AosoaPack<T>::lanes) {
+                function(offset);
+            }
+        }
+
+        template<typename Value>
+        [[nodiscard]] inline auto load_component(const AosoaBlock<Value>& block, std::size_t component, std::size_t offset) noexcept
+        {
+            using T = typename AosoaBlock<Value>::scalar_type;
+            return AosoaPack<T>::load(block[component].data() + offset);
+        }
+
+        template<typename T, std::size_t N>
+        inline void multiply_block(const AosoaBlock<Matrix<T, N, N>>& lhs, const AosoaBlock<Matrix<T, N, N>>& rhs, AosoaBlock<Matrix<T, N, N>>& result) noexcept
+        {
+            for_each_pack<T>([&](std::size_t offset) {
+                static_for<0, N>([&](auto i) {
+                    static_for<0, N>([&](auto j) {
+                        auto sum = load_component(lhs, i * N, offset) * load_component(rhs, j, offset);
+                        static_for<1, N>([&](auto k) { sum = fmadd(load_component(lhs, i * N + k, offset), load_component(rhs, k * N + j, offset), sum); });
+                        sum.store(result[i * N + j].data() + offset);
+                    });
+                });
+            });
+        }
+
+        template<typename T>
+        [[nodiscard]] inline AosoaPack<T> determinant_pack(const AosoaBlock<Matrix<T, 3, 3>>& block, std::size_t offset) noexcept
+        {
+            auto m = [&](std::size_t row, std::size_t column) { return load_component(block, row * 3 + column, offset); };
+            return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) +
+                   m(0, 1) * (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) +
+                   m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+        }
+
+        // 2x2 minors of the top two rows (s) and the bottom two rows (c) of a 4x4
+        // matrix, shared by its determinant and its adjugate
+        template<typename T>
+        struct Minors4 {
+            std::array<AosoaPack<T>, 6> s;
+            std::array<AosoaPack<T>, 6> c;
+
+            [[nodiscard]] AosoaPack<T> determinant() const noexcept
+            {
+                return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+            }
+        };
+
+        template<typename T>
+        [[nodiscard]] inline Minors4<T> minors_pack(const AosoaBlock<Matrix<T, 4, 4>>& block, std::size_t offset) noexcept
+        {
+            auto m = [&](std::size_t row, std::size_t column) { return load_component(block, row * 4 + column, offset); };
+            auto minor = [&](std::size_t row, std::size_t c0, std::size_t c1) { return m(row, c0) * m(row + 1, c1) - m(row + 1, c0) * m(row, c1); };
+            return {
+                {minor(0, 0, 1), minor(0, 0, 2), minor(0, 0, 3), minor(0, 1, 2), minor(0, 1, 3), minor(0, 2, 3)},
+                {minor(2, 0, 1), minor(2, 0, 2), minor(2, 0, 3), minor(2, 1, 2), minor(2, 1, 3), minor(2, 2, 3)}};
+        }
+
+        template<typename T>
+        [[nodiscard]] inline AosoaPack<T> determinant_pack(const AosoaBlock<Matrix<T, 4, 4>>& block, std::size_t offset) noexcept
+        {
+            return minors_pack(block, offset).determinant();
+        }
+
+        // Adjugate over determinant. Singular lanes produce infinities or NaNs
+        // instead of branching, callers that need to know check batch_determinant.
+        // result must not alias block.
+        template<typename T>
+        inline void inverse_block(const AosoaBlock<Matrix<T, 3, 3>>& block, AosoaBlock<Matrix<T, 3, 3>>& result) noexcept
+        {
+            for_each_pack<T>([&](std::size_t offset) {
+                auto m = [&](std::size_t row, std::size_t column) { return load_component(block, row * 3 + column, offset); };
+                auto store = [&](std::size_t row, std::size_t column, const AosoaPack<T>& value) { value.store(result[row * 3 + column].data() + offset); };
+                const auto c00 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+                const auto c10 = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+                const auto c20 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+                const auto scale = AosoaPack<T>::broadcast(T{1}) / (m(0, 0) * c00 + m(0, 1) * c10 + m(0, 2) * c20);
+                store(0, 0, c00 * scale);
+                store(0, 1, (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * scale);
+                store(0, 2, (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * scale);
+                store(1, 0, c10 * scale);
+                store(1, 1, (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * scale);
+                store(1, 2, (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * scale);
+                store(2, 0, c20 * scale);
+                store(2, 1, (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * scale);
+                store(2, 2, (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * scale);
+            });
+        }
+
+        template<typename T>
+        inline void inverse_block(const AosoaBlock<Matrix<T, 4, 4>>& block, AosoaBlock<Matrix<T, 4, 4>>& result) noexcept
+        {
+            for_each_pack<T>([&](std::size_t offset) {
+                auto m = [&](std::size_t row, std::size_t column) { return load_component(block, row * 4 + column, offset); };
+                auto store = [&](std::size_t row, std::size_t column, const AosoaPack<T>& value) { value.store(result[row * 4 + column].data() + offset); };
+                const auto minors = minors_pack(block, offset);
+                const auto& s = minors.s;
+                const auto& c = minors.c;
+                const auto scale = AosoaPack<T>::broadcast(T{1}) / minors.determinant();
+                // Rows of the adjugate pair rows of one half of the matrix with the minors of the other half
+                store(0, 0, (m(1, 1) * c[5] - m(1, 2) * c[4] + m(1, 3) * c[3]) * scale);
+                store(0, 1, (m(0, 2) * c[4] - m(0, 1) * c[5] - m(0, 3) * c[3]) * scale);
+                store(0, 2, (m(3, 1) * s[5] - m(3, 2) * s[4] + m(3, 3) * s[3]) * scale);
+                store(0, 3, (m(2, 2) * s[4] - m(2, 1) * s[5] - m(2, 3) * s[3]) * scale);
+                store(1, 0, (m(1, 2) * c[2] - m(1, 0) * c[5] - m(1, 3) * c[1]) * scale);
+                store(1, 1, (m(0, 0) * c[5] - m(0, 2) * c[2] + m(0, 3) * c[1]) * scale);
+                store(1, 2, (m(3, 2) * s[2] - m(3, 0) * s[5] - m(3, 3) * s[1]) * scale);
+                store(1, 3, (m(2, 0) * s[5] - m(2, 2) * s[2] + m(2, 3) * s[1]) * scale);
+                store(2, 0, (m(1, 0) * c[4] - m(1, 1) * c[2] + m(1, 3) * c[0]) * scale);
+                store(2, 1, (m(0, 1) * c[2] - m(0, 0) * c[4] - m(0, 3) * c[0]) * scale);
+                store(2, 2, (m(3, 0) * s[4] - m(3, 1) * s[2] + m(3, 3) * s[0]) * scale);
+                store(2, 3, (m(2, 1) * s[2] - m(2, 0) * s[4] - m(2, 3) * s[0]) * scale);
+                store(3, 0, (m(1, 1) * c[1] - m(1, 0) * c[3] - m(1, 2) * c[0]) * scale);
+                store(3, 1, (m(0, 0) * c[3] - m(0, 1) * c[1] + m(0, 2) * c[0]) * scale);
+                store(3, 2, (m(3, 1) * s[1] - m(3, 0) * s[3] - m(3, 2) * s[0]) * scale);
+                store(3, 3, (m(2, 0) * s[3] - m(2, 1) * s[1] + m(2, 2) * s[0]) * scale);
+            });
+        }
+    } // namespace detail
+
+    // result[i] = lhs[i] * rhs[i]; result may be lhs or rhs
+    template<typename T, std::size_t N>
+    void batch_multiply(const MatrixBatch<T, N>& lhs, const MatrixBatch<T, N>& rhs, MatrixBatch<T, N>& result, unsigned thread_count = 1)
+    {
+        detail::check_batch_sizes(lhs.size(), rhs.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(lhs.size());
+        const auto lhs_blocks = lhs.blocks();
+        const auto rhs_blocks = rhs.blocks();
+        const auto result_blocks = result.blocks();
+        parallel_for(lhs_blocks.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto block = begin; block < end; ++block) {
+                AosoaBlock<Matrix<T, N, N>> product;
+                detail::multiply_block(lhs_blocks[block], rhs_blocks[block], product);
+                result_blocks[block] = product;
+            }
+        }, detail::aosoa_min_chunk_blocks);
+    }
+
+    // result[i] = inverse of matrices[i]; result may be matrices. Singular
+    // matrices produce non-finite elements, see batch_determinant.
+    template<typename T, std::size_t N>
+        requires(N == 3 || N == 4)
+    void batch_inverse(const MatrixBatch<T, N>& matrices, MatrixBatch<T, N>& result, unsigned thread_count = 1)
+    {
+        detail::check_batch_sizes(matrices.size(), matrices.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(matrices.size());
+        const auto blocks = matrices.blocks();
+        const auto result_blocks = result.blocks();
+        parallel_for(blocks.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto block = begin; block < end; ++block) {
+                AosoaBlock<Matrix<T, N, N>> inverse;
+                detail::inverse_block(blocks[block], inverse);
+                result_blocks[block] = inverse;
+            }
+        }, detail::aosoa_min_chunk_blocks);
+    }
+
+    template<typename T, std::size_t N>
+        requires(N == 3 || N == 4)
+    void batch_determinant(const MatrixBatch<T, N>& matrices, std::type_identity_t<std::span<T>> result, unsigned thread_count = 1)
+    {
+        detail::check_batch_sizes(matrices.size(), matrices.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(matrices.size());
+        const auto blocks = matrices.blocks();
+        parallel_for(blocks.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto block = begin; block < end; ++block) {
+                AosoaLanes<T> determinants;
+                detail::for_each_pack<T>([&](std::size_t offset) { detail::determinant_pack(blocks[block], offset).store(determinants.data() + offset); });
+                const auto first = block * aosoa_lanes;
+                for (std::size_t lane = 0; lane < aosoa_lanes && first + lane < result.size(); ++lane) {
+                    result[first + lane] = determinants[lane];
+                }
+            }
+        }, detail::aosoa_min_chunk_blocks);
+    }
+
+    // x[i] with matrices[i] * x[i] = b[i] (column vector convention, as solve()).
+    // Goes through the explicit inverse, which needs no pivoting and so stays
+    // branch free across lanes; the extra rounding is negligible for the
+    // well-conditioned systems of contact and joint solvers. x may be b.
+    template<typename T, std::size_t N>
+        requires(N == 3 || N == 4)
+    void batch_solve(const MatrixBatch<T, N>& matrices, const VectorBatch<T, N>& b, VectorBatch<T, N>& x, unsigned thread_count = 1)
+    {
+        detail::check_batch_sizes(matrices.size(), b.size(), x.size());
+        ORION_MATH_INSTRUMENT_BATCH(matrices.size());
+        const auto blocks = matrices.blocks();
+        const auto b_blocks = b.blocks();
+        const auto x_blocks = x.blocks();
+        parallel_for(blocks.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (auto block = begin; block < end; ++block) {
+                AosoaBlock<Matrix<T, N, N>> inverse;
+                detail::inverse_block(blocks[block], inverse);
+                AosoaBlock<Vector<T, N>> solution;
+                detail::for_each_pack<T>([&](std::size_t offset) {
+                    detail::static_for<0, N>([&](auto i) {
+                        auto sum = detail::load_component(inverse, i * N, offset) * detail::load_component(b_blocks[block], 0, offset);
+                        detail::static_for<1, N>([&](auto j) { sum = fmadd(detail::load_component(inverse, i * N + j, offset), detail::load_component(b_blocks[block], j, offset), sum); });
+                        sum.store(solution[i].data() + offset);
+                    });
+                });
+                x_blocks[block] = solution;
+            }
+        }, detail::aosoa_min_chunk_blocks);
+    }
+} // namespace orion::math
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "matrix4.h"
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/simd.h"       // simd::Pack
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument, std::out_of_range
+#include <type_traits> // std::type_identity_t
+
+namespace orion::math
+{
+    namespace detail
+    {
+        template<typename T>
+        using Row4 = simd::Pack<T, 4>;
+
+        template<typename T>
+        using Matrix4Rows = std::array<Row4<T>, 4>;
+
+        template<typename T>
+        [[nodiscard]] inline Matrix4Rows<T> load_rows(const Matrix4_t<T>& matrix) noexcept
+        {
+            return {
+                Row4<T>::load(matrix[0].data()),
+                Row4<T>::load(matrix[1].data()),
+                Row4<T>::load(matrix[2].data()),
+                Row4<T>::load(matrix[3].data())};
+        }
+
+        // Row i of lhs * rhs is the combination of rhs rows weighted by lhs[i],
+        // so rhs stays in registers while lhs is streamed one row at a time.
+        // Each row of lhs is read before the matching row of result is written,
+        // which makes result == lhs safe.
+        template<typename T>
+        inline void multiply_rows(const Matrix4_t<T>& lhs, const Matrix4Rows<T>& rhs, Matrix4_t<T>& result) noexcept
+        {
+            for (std::size_t i = 0; i < 4; ++i) {
+                auto row = Row4<T>::broadcast(lhs[i][0]) * rhs[0];
+                row = fmadd(Row4<T>::broadcast(lhs[i][1]), rhs[1], row);
+                row = fmadd(Row4<T>::broadcast(lhs[i][2]), rhs[2], row);
+                row = fmadd(Row4<T>::broadcast(lhs[i][3]), rhs[3], row);
+                row.store(result[i].data());
+            }
+        }
+
+        inline void check_batch_sizes(std::size_t lhs, std::size_t rhs, std::size_t result)
+        {
+            if (lhs != rhs || lhs != result) {
+                throw std::invalid_argument("batch spans must have the same size");
+            }
+        }
+    } // namespace detail
+
+    // result[i] = lhs[i] * rhs[i]
+    template<typename T = float>
+    void batch_multiply(std::type_identity_t<std::span<const Matrix4_t<T>>> lhs,
+                        std::type_identity_t<std::span<const Matrix4_t<T>>> rhs,
+                        std::type_identity_t<std::span<Matrix4_t<T>>> result)
+    {
+        detail::check_batch_sizes(lhs.size(), rhs.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(lhs.size());
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            detail::multiply_rows(lhs[i], detail::load_rows(rhs[i]), result[i]);
+        }
+    }
+
+    // result[i] = lhs[i] * rhs
+    template<typename T = float>
+    void batch_multiply(std::type_identity_t<std::span<const Matrix4_t<T>>> lhs,
+                        const std::type_identity_t<Matrix4_t<T>>& rhs,
+                        std::type_identity_t<std::span<Matrix4_t<T>>> result)
+    {
+        detail::check_batch_sizes(lhs.size(), lhs.size(), result.size());
+        ORION_MATH_INSTRUMENT_BATCH(lhs.size());
+        const auto rhs_rows = detail::load_rows(rhs);
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            detail::multiply_rows(lhs[i], rhs_rows, result[i]);
+        }
+    }
+
+    // Resolves a hierarchy stored in parent-before-child order:
+    // world[i] = local[i] * world[parents[i]], or local[i] * root when parents[i] is negative.
+    template<typename T = float>
+    void batch_multiply_hierarchy(std::type_identity_t<std::span<const Matrix4_t<T>>> local,
+                                  std::span<const std::int32_t> parents,
+                                  std::type_identity_t<std::span<Matrix4_t<T>>> world,
+                                  const std::type_identity_t<Matrix4_t<T>>& root = Matrix4_t<T>::identity())
+    {
+        detail::check_batch_sizes(local.size(), parents.size(), world.size());
+        ORION_MATH_INSTRUMENT_BATCH(local.size());
+        const auto root_rows = detail::load_rows(root);
+        for (std::size_t i = 0; i < local.size(); ++i) {
+            const auto parent = parents[i];
+            if (parent < 0) {
+                detail::multiply_rows(local[i], root_rows, world[i]);
+            } else if (static_cast<std::size_t>(parent) < i) {
+                detail::multiply_rows(local[i], detail::load_rows(world[static_cast<std::size_t>(parent)]), world[i]);
+            } else {
+                throw std::out_of_range("parent index must precede its child");
+            }
+        }
+    }
+} // namespace orion::math
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "matrix3.h"
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for
+#include "orion-math/vector/vector3.h"
+
+#include <cmath>       // std::abs, std::sqrt
+#include <cstddef>     // std::size_t
+#include <limits>      // std::numeric_limits
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::swap
+
+namespace orion::math
+{
+    // Eigenvalues in descending order. Row i of vectors is the unit eigenvector
+    // of values[i]; the rows form a right-handed orthonormal basis, so vectors
+    // is the rotation taking the eigenbasis into the original space (v * vectors).
+    template<typename T>
+    struct SymmetricEigen3 {
+        Vector3_t<T> values;
+        Matrix3_t<T> vectors;
+    };
+
+    // Cyclic Jacobi converges quadratically, this many sweeps reach full float
+    // and double precision for any symmetric 3x3 input
+    inline constexpr std::size_t jacobi_sweeps = 6;
+
+    namespace detail
+    {
+        // Zeroes a[P][Q] with a plane rotation and accumulates it into v, whose
+        // columns converge to the eigenvectors. A zero pivot produces the identity
+        // rotation without branching.
+        template<std::size_t P, std::size_t Q, typename T>
+        inline void jacobi_rotate(Matrix3_t<T>& a, Matrix3_t<T>& v) noexcept
+        {
+            constexpr std::size_t R = 3 - P - Q;
+            const auto apq = a[P][Q];
+            const auto difference = a[Q][Q] - a[P][P];
+            const auto sign = difference < 0 ? T{-1} : T{1};
+            const auto t = T{2} * apq * sign / (std::abs(difference) + std::sqrt(difference * difference + T{4} * apq * apq) + std::numeric_limits<T>::min());
+            const auto c = T{1} / std::sqrt(t * t + T{1});
+            const auto s = t * c;
+
+            a[P][P] -= t * apq;
+            a[Q][Q] += t * apq;
+            a[P][Q] = a[Q][P] = T{0};
+            const auto arp = a[R][P];
+            const auto arq = a[R][Q];
+            a[R][P] = a[P][R] = c * arp - s * arq;
+            a[R][Q] = a[Q][R] = s * arp + c * arq;
+
+            for (std::size_t k = 0; k < 3; ++k) {
+                const auto vkp = v[k][P];
+                const auto vkq = v[k][Q];
+                v[k][P] = c * vkp - s * vkq;
+                v[k][Q] = s * vkp + c * vkq;
+            }
+        }
+
+        template<typename T>
+        inline void sort_eigen_pair(SymmetricEigen3<T>& eigen, std::size_t lhs, std::size_t rhs) noexcept
+        {
+            if (eigen.values[lhs] < eigen.values[rhs]) {
+                std::swap(eigen.values[lhs], eigen.values[rhs]);
+                std::swap(eigen.vectors[lhs], eigen.vectors[rhs]);
+            }
+        }
+    } // namespace detail
+
+    // Eigen decomposition of a symmetric matrix (only the upper triangle is
+    // read) by a fixed number of unrolled cyclic Jacobi sweeps
+    template<typename T>
+    [[nodiscard]] SymmetricEigen3<T> eigen_symmetric(const Matrix3_t<T>& matrix, std::size_t sweeps = jacobi_sweeps) noexcept
+    {
+        Matrix3_t<T> a{
+            matrix[0][0], matrix[0][1], matrix[0][2],
+            matrix[0][1], matrix[1][1], matrix[1][2],
+            matrix[0][2], matrix[1][2], matrix[2][2]};
+        auto v = Matrix3_t<T>::identity();
+        for (std::size_t sweep = 0; sweep < sweeps; ++sweep) {
+            detail::jacobi_rotate<0, 1>(a, v);
+            detail::jacobi_rotate<0, 2>(a, v);
+            detail::jacobi_rotate<1, 2>(a, v);
+        }
+
+        SymmetricEigen3<T> result{{a[0][0], a[1][1], a[2][2]}, v.transpose()};
+        detail::sort_eigen_pair(result, 0, 1);
+        detail::sort_eigen_pair(result, 1, 2);
+        detail::sort_eigen_pair(result, 0, 1);
+
+        if (dot(cross(result.vectors[0], result.vectors[1]), result.vectors[2]) < 0) {
+            result.vectors[2] = -result.vectors[2];
+        }
+        return result;
+    }
+
+    // result[i] = eigen_symmetric(matrices[i])
+    template<typename T = float>
+    void batch_eigen_symmetric(std::type_identity_t<std::span<const Matrix3_t<T>>> matrices,
+                               std::type_identity_t<std::span<SymmetricEigen3<T>>> result,
+                               unsigned thread_count = 1)
+    {
+        if (matrices.size() != result.size()) {
+            throw std::invalid_argument("batch spans must have the same size");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(matrices.size());
+        parallel_for(matrices.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t i = begin; i < end; ++i) {
+                result[i] = eigen_symmetric(matrices[i]);
+            }
+        });
+    }
+} // namespace orion::math
@@ -1,16 +1,53 @@
 #pragma once
 
 #include "orion-math/concepts.h"      // arithmetic
+#include "orion-math/fma.h"           // fmadd
 #include "orion-math/func.h"          // negate, plus, minus
+#include "orion-math/instrument.h"    // ORION_MATH_COUNT
 #include "orion-math/vector/vector.h" // vector
 
-#include <algorithm> // std::transform
-#include <array>     // std::array
-#include <cstddef>   // std::size_t
-#include <stdexcept> // std::out_of_range
+#include <algorithm>   // std::transform
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <stdexcept>   // std::out_of_range
+#include <type_traits> // std::common_type_t, std::integral_constant
+#include <utility>     // std::index_sequence, std::make_index_sequence
 
 namespace orion::math
 {
+    namespace detail
+    {
+        // Sum of lhs(k) * rhs(k) for k < N as a chain of fused multiply-adds,
+        // expanded into straight-line code for the sizes vectors and transforms use
+        template<typename T, std::size_t N, typename Lhs, typename Rhs>
+        [[nodiscard]] constexpr T fused_sum(Lhs&& lhs, Rhs&& rhs) noexcept
+        {
+            T sum{};
+            if constexpr (N <= 4) {
+                [&]<std::size_t... K>(std::index_sequence<K...>) {
+                    ((sum = fmadd(static_cast<T>(lhs(K)), static_cast<T>(rhs(K)), sum)), ...);
+                }(std::make_index_sequence<N>{});
+            } else {
+                for (std::size_t k = 0; k < N; ++k) {
+                    sum = fmadd(static_cast<T>(lhs(k)), static_cast<T>(rhs(k)), sum);
+                }
+            }
+            return sum;
+        }
+
+        // Calls f(std::integral_constant<std::size_t, I>) for First <= I < Last, so
+        // nested ranges can start from an outer index and still be known at compile time
+        template<std::size_t First, std::size_t Last, typename F>
+        constexpr void static_for(F&& f)
+        {
+            if constexpr (First < Last) {
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    (f(std::integral_constant<std::size_t, First + I>{}), ...);
+                }(std::make_index_sequence<Last - First>{});
+            }
+        }
+    } // namespace detail
+
     template<typename T, std::size_t Rows, std::size_t Cols>
     struct Matrix {
         using value_type = T;
@@ -44,8 +81,8 @@ namespace orion::math
         [[nodiscard]] static constexpr size_type size() noexcept { return rows * columns; }
         [[nodiscard]] static constexpr bool is_empty() noexcept { return size() == 0; }
 
-        [[nodiscard]] constexpr pointer data() noexcept { return elements_.data(); }
-        [[nodiscard]] constexpr const_pointer data() const noexcept { return elements_.data(); }
+        [[nodiscard]] constexpr pointer data() noexcept { return elements_.data()->data(); }
+        [[nodiscard]] constexpr const_pointer data() const noexcept { return elements_.data()->data(); }
 
         [[nodiscard]] constexpr row_type& operator[](size_type idx) noexcept { return elements_[idx]; }
         [[nodiscard]] constexpr const row_type& operator[](size_type idx) const noexcept { return elements_[idx]; }
@@ -85,13 +122,14 @@ namespace orion::math
         [[nodiscard]] constexpr friend auto operator*(const Matrix& lhs, const Matrix<T1, Rows1, Cols1>& rhs) noexcept
             requires(lhs.columns == rhs.rows)
         {
+            ORION_MATH_COUNT(matrix_multiply);
             using common_type = std::common_type_t<T, T1>;
             Matrix<common_type, Rows, Cols1> result;
             for (std::size_t i = 0; i < lhs.rows; ++i) {
                 for (std::size_t j = 0; j < rhs.columns; ++j) {
                     common_type sum{};
                     for (std::size_t k = 0; k < lhs.columns; ++k) {
-                        sum += lhs[i][k] * rhs[k][j];
+                        sum = fmadd(static_cast<common_type>(lhs[i][k]), static_cast<common_type>(rhs[k][j]), sum);
                     }
                     result[i][j] = sum;
                 }
@@ -99,6 +137,34 @@ namespace orion::math
             return result;
         }
 
+        // Row vector times matrix (v * M), the convention transformation.h builds its matrices for
+        template<typename T1>
+        [[nodiscard]] constexpr friend auto operator*(const Vector<T1, Rows>& vector, const Matrix& matrix) noexcept
+        {
+            using common_type = std::common_type_t<T1, T>;
+            Vector<common_type, Cols> result;
+            for (std::size_t j = 0; j < Cols; ++j) {
+                result[j] = detail::fused_sum<common_type, Rows>(
+                    [&vector](std::size_t k) { return vector[k]; },
+                    [&matrix, j](std::size_t k) { return matrix[k][j]; });
+            }
+            return result;
+        }
+
+        // Matrix times column vector (M * v)
+        template<typename T1>
+        [[nodiscard]] constexpr friend auto operator*(const Matrix& matrix, const Vector<T1, Cols>& vector) noexcept
+        {
+            using common_type = std::common_type_t<T, T1>;
+            Vector<common_type, Rows> result;
+            for (std::size_t i = 0; i < Rows; ++i) {
+                result[i] = detail::fused_sum<common_type, Cols>(
+                    [&matrix, i](std::size_t k) { return matrix[i][k]; },
+                    [&vector](std::size_t k) { return vector[k]; });
+            }
+            return result;
+        }
+
         [[nodiscard]] constexpr auto transpose() const noexcept -> Matrix<value_type, Cols, Rows>
         {
             Matrix<value_type, Cols, Rows> result;
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "matrix.h"
+#include "orion-math/abs.h"  // abs
+#include "orion-math/fma.h"  // fmadd
+#include "orion-math/sqrt.h" // sqrt
+#include "orion-math/vector/vector.h"
+
+#include <array>       // std::array
+#include <cmath>       // std::sqrt
+#include <concepts>    // std::floating_point
+#include <cstddef>     // std::size_t
+#include <optional>    // std::optional, std::nullopt
+#include <type_traits> // std::integral_constant, std::is_constant_evaluated
+#include <utility>     // std::swap
+
+namespace orion::math
+{
+    // The solvers expand every loop into straight-line code, which pays off for
+    // the small systems of constraints and IK chains and stops paying off above
+    // this size. Larger systems run the same steps as runtime loops.
+    inline constexpr std::size_t max_unrolled_solve = 8;
+
+    namespace detail
+    {
+        template<std::floating_point T>
+        [[nodiscard]] constexpr T solver_sqrt(T value) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return sqrt(value);
+            }
+            return std::sqrt(value);
+        }
+
+        // Loop indices are std::integral_constant while N is unrolled and
+        // std::size_t above, so one body serves both. solver_index, solver_next
+        // and solver_reverse keep bounds derived from an outer index constant.
+        template<std::size_t I>
+        inline constexpr std::integral_constant<std::size_t, I> solver_index{};
+
+        template<std::size_t I>
+        [[nodiscard]] constexpr auto solver_next(std::integral_constant<std::size_t, I>) noexcept
+        {
+            return solver_index<I + 1>;
+        }
+
+        [[nodiscard]] constexpr std::size_t solver_next(std::size_t index) noexcept
+        {
+            return index + 1;
+        }
+
+        // N - 1 - index, for loops running back to front
+        template<std::size_t N, std::size_t I>
+        [[nodiscard]] constexpr auto solver_reverse(std::integral_constant<std::size_t, I>) noexcept
+        {
+            return solver_index<N - 1 - I>;
+        }
+
+        template<std::size_t N>
+        [[nodiscard]] constexpr std::size_t solver_reverse(std::size_t index) noexcept
+        {
+            return N - 1 - index;
+        }
+
+        // Calls f(index) for first <= index < last
+        template<std::size_t N, typename First, typename Last, typename F>
+        constexpr void solver_for(First first, Last last, F&& f)
+        {
+            if constexpr (N <= max_unrolled_solve) {
+                static_for<First::value, Last::value>(f);
+            } else {
+                for (std::size_t index = first; index < last; ++index) {
+                    f(index);
+                }
+            }
+        }
+    } // namespace detail
+
+    // P * A = L * U with L unit lower triangular and U upper triangular
+    template<typename T, std::size_t N>
+    struct LuDecomposition {
+        // L below the diagonal, its unit diagonal implied, and U on and above it
+        Matrix<T, N, N> factors{};
+        // Row i of factors was row permutation[i] of A
+        std::array<std::size_t, N> permutation{};
+        bool odd_permutation = false;
+
+        [[nodiscard]] constexpr T determinant() const noexcept
+        {
+            T result{1};
+            for (std::size_t i = 0; i < N; ++i) {
+                result *= factors[i][i];
+            }
+            return odd_permutation ? -result : result;
+        }
+    };
+
+    // Gaussian elimination with partial pivoting. Empty when a pivot is exactly
+    // zero, nearly singular matrices decompose and produce large solutions.
+    template<std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr std::optional<LuDecomposition<T, N>> lu_decompose(const Matrix<T, N, N>& matrix) noexcept
+    {
+        constexpr auto first = detail::solver_index<0>;
+        constexpr auto last = detail::solver_index<N>;
+        LuDecomposition<T, N> result{matrix};
+        auto& a = result.factors;
+        auto& permutation = result.permutation;
+        detail::solver_for<N>(first, last, [&](auto i) { permutation[i] = i; });
+
+        bool singular = false;
+        detail::solver_for<N>(first, last, [&](auto k) {
+            if (singular) {
+                return;
+            }
+            std::size_t pivot = k;
+            detail::solver_for<N>(detail::solver_next(k), last, [&](auto i) {
+                if (abs(a[i][k]) > abs(a[pivot][k])) {
+                    pivot = i;
+                }
+            });
+            if (pivot != k) {
+                std::swap(a[k], a[pivot]);
+                std::swap(permutation[k], permutation[pivot]);
+                result.odd_permutation = !result.odd_permutation;
+            }
+            if (a[k][k] == T{0}) {
+                singular = true;
+                return;
+            }
+
+            const auto inverse_pivot = T{1} / a[k][k];
+            detail::solver_for<N>(detail::solver_next(k), last, [&](auto i) {
+                const auto factor = a[i][k] * inverse_pivot;
+                a[i][k] = factor;
+                detail::solver_for<N>(detail::solver_next(k), last, [&](auto j) { a[i][j] = fmadd(-factor, a[k][j], a[i][j]); });
+            });
+        });
+
+        if (singular) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    // Solves A * x = b for the A that was decomposed
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> lu_solve(const LuDecomposition<T, N>& lu, const Vector<T, N>& b) noexcept
+    {
+        constexpr auto first = detail::solver_index<0>;
+        constexpr auto last = detail::solver_index<N>;
+        const auto& a = lu.factors;
+        Vector<T, N> x{};
+        detail::solver_for<N>(first, last, [&](auto i) {
+            auto sum = b[lu.permutation[i]];
+            detail::solver_for<N>(first, i, [&](auto j) { sum = fmadd(-a[i][j], x[j], sum); });
+            x[i] = sum;
+        });
+        detail::solver_for<N>(first, last, [&](auto r) {
+            const auto i = detail::solver_reverse<N>(r);
+            auto sum = x[i];
+            detail::solver_for<N>(detail::solver_next(i), last, [&](auto j) { sum = fmadd(-a[i][j], x[j], sum); });
+            x[i] = sum / a[i][i];
+        });
+        return x;
+    }
+
+    // Lower triangular L with A = L * L^T. Only the lower triangle of A is read.
+    // Empty when A is not symmetric positive definite.
+    template<std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr std::optional<Matrix<T, N, N>> cholesky_decompose(const Matrix<T, N, N>& matrix) noexcept
+    {
+        constexpr auto first = detail::solver_index<0>;
+        constexpr auto last = detail::solver_index<N>;
+        Matrix<T, N, N> l{};
+        bool positive_definite = true;
+        detail::solver_for<N>(first, last, [&](auto j) {
+            if (!positive_definite) {
+                return;
+            }
+            auto diagonal = matrix[j][j];
+            detail::solver_for<N>(first, j, [&](auto k) { diagonal = fmadd(-l[j][k], l[j][k], diagonal); });
+            if (!(diagonal > T{0})) {
+                positive_definite = false;
+                return;
+            }
+
+            const auto root = detail::solver_sqrt(diagonal);
+            const auto inverse_root = T{1} / root;
+            l[j][j] = root;
+            detail::solver_for<N>(detail::solver_next(j), last, [&](auto i) {
+                auto sum = matrix[i][j];
+                detail::solver_for<N>(first, j, [&](auto k) { sum = fmadd(-l[i][k], l[j][k], sum); });
+                l[i][j] = sum * inverse_root;
+            });
+        });
+
+        if (!positive_definite) {
+            return std::nullopt;
+        }
+        return l;
+    }
+
+    // Solves A * x = b given the Cholesky factor L of A
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> cholesky_solve(const Matrix<T, N, N>& l, const Vector<T, N>& b) noexcept
+    {
+        constexpr auto first = detail::solver_index<0>;
+        constexpr auto last = detail::solver_index<N>;
+        Vector<T, N> x{};
+        detail::solver_for<N>(first, last, [&](auto i) {
+            auto sum = b[i];
+            detail::solver_for<N>(first, i, [&](auto j) { sum = fmadd(-l[i][j], x[j], sum); });
+            x[i] = sum / l[i][i];
+        });
+        detail::solver_for<N>(first, last, [&](auto r) {
+            const auto i = detail::solver_reverse<N>(r);
+            auto sum = x[i];
+            detail::solver_for<N>(detail::solver_next(i), last, [&](auto j) { sum = fmadd(-l[j][i], x[j], sum); });
+            x[i] = sum / l[i][i];
+        });
+        return x;
+    }
+
+    // x with A * x = b (column vector convention), empty when A is singular
+    template<std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr std::optional<Vector<T, N>> solve(const Matrix<T, N, N>& matrix, const Vector<T, N>& b) noexcept
+    {
+        if (const auto lu = lu_decompose(matrix)) {
+            return lu_solve(*lu, b);
+        }
+        return std::nullopt;
+    }
+
+    // solve() for symmetric positive definite A, such as the normal equations or
+    // constraint mass matrices, at about half the cost and without pivoting.
+    // Empty when A is not positive definite.
+    template<std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr std::optional<Vector<T, N>> solve_spd(const Matrix<T, N, N>& matrix, const Vector<T, N>& b) noexcept
+    {
+        if (const auto l = cholesky_decompose(matrix)) {
+            return cholesky_solve(*l, b);
+        }
+        return std::nullopt;
+    }
+} // namespace orion::math
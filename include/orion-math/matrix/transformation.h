@@ -2,17 +2,72 @@
 
 #include "matrix4.h"
 #include "orion-math/angles.h"
+#include "orion-math/fma.h" // fmadd
+#include "orion-math/instrument.h"
 #include "orion-math/trig.h"
 #include "orion-math/vector/vector3.h"
 
 namespace orion::math
 {
+    // Selects the transform_point overload that divides by the resulting w
+    struct PerspectiveDivide {
+        explicit PerspectiveDivide() = default;
+    };
+
+    inline constexpr PerspectiveDivide perspective_divide{};
+
+    // Point with an implied w of 1. The fourth column is ignored, which is
+    // exact for affine transforms.
+    template<typename T>
+    [[nodiscard]] constexpr Vector3_t<T> transform_point(const Vector3_t<T>& point, const Matrix4_t<T>& matrix) noexcept
+    {
+        return {
+            fmadd(point[0], matrix[0][0], fmadd(point[1], matrix[1][0], fmadd(point[2], matrix[2][0], matrix[3][0]))),
+            fmadd(point[0], matrix[0][1], fmadd(point[1], matrix[1][1], fmadd(point[2], matrix[2][1], matrix[3][1]))),
+            fmadd(point[0], matrix[0][2], fmadd(point[1], matrix[1][2], fmadd(point[2], matrix[2][2], matrix[3][2])))};
+    }
+
+    // Point with an implied w of 1, projected back to w = 1 afterwards
+    template<typename T>
+    [[nodiscard]] constexpr Vector3_t<T> transform_point(const Vector3_t<T>& point, const Matrix4_t<T>& matrix, PerspectiveDivide) noexcept
+    {
+        const auto w = fmadd(point[0], matrix[0][3], fmadd(point[1], matrix[1][3], fmadd(point[2], matrix[2][3], matrix[3][3])));
+        const auto result = transform_point(point, matrix);
+        return {result[0] / w, result[1] / w, result[2] / w};
+    }
+
+    // Direction with an implied w of 0, translation does not apply
+    template<typename T>
+    [[nodiscard]] constexpr Vector3_t<T> transform_direction(const Vector3_t<T>& direction, const Matrix4_t<T>& matrix) noexcept
+    {
+        return {
+            fmadd(direction[0], matrix[0][0], fmadd(direction[1], matrix[1][0], direction[2] * matrix[2][0])),
+            fmadd(direction[0], matrix[0][1], fmadd(direction[1], matrix[1][1], direction[2] * matrix[2][1])),
+            fmadd(direction[0], matrix[0][2], fmadd(direction[1], matrix[1][2], direction[2] * matrix[2][2]))};
+    }
+
+    // Surface normal through the inverse transpose of the upper 3x3 block, so it
+    // stays perpendicular under non-uniform scale. The inverse transpose is the
+    // cofactor matrix over the determinant, whose rows are cross products of the
+    // matrix rows. The result is not renormalized.
+    template<typename T>
+    [[nodiscard]] constexpr Vector3_t<T> transform_normal(const Vector3_t<T>& normal, const Matrix4_t<T>& matrix) noexcept
+    {
+        const Vector3_t<T> row0{matrix[0][0], matrix[0][1], matrix[0][2]};
+        const Vector3_t<T> row1{matrix[1][0], matrix[1][1], matrix[1][2]};
+        const Vector3_t<T> row2{matrix[2][0], matrix[2][1], matrix[2][2]};
+        const auto cofactor0 = cross(row1, row2);
+        const auto cofactor1 = cross(row2, row0);
+        const auto cofactor2 = cross(row0, row1);
+        const auto determinant = dot(row0, cofactor0);
+        return (cofactor0 * normal[0] + cofactor1 * normal[1] + cofactor2 * normal[2]) / determinant;
+    }
+
     template<typename T>
     [[nodiscard]] constexpr Vector3_t<T> transform(const Vector3_t<T>& vector, const Matrix4_t<T>& transform)
     {
-        const Matrix<T, 1, 4> vector_matrix{vector[0], vector[1], vector[2], T{1}};
-        const auto result = vector_matrix * transform;
-        return {result[0][0], result[0][1], result[0][2]};
+        ORION_MATH_COUNT(transform);
+        return transform_point(vector, transform);
     }
 
     template<typename T>
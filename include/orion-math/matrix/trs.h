@@ -0,0 +1,144 @@
+#pragma once
+
+#include "matrix4.h"
+#include "orion-math/vector/quaternion.h"
+#include "orion-math/vector/vector3.h"
+
+#include <cmath>   // std::sqrt
+#include <cstddef> // std::size_t
+
+namespace orion::math
+{
+    // Row vector rotation matrix of a unit quaternion, matching rotation_x/y/z
+    template<typename T>
+    [[nodiscard]] constexpr Matrix4_t<T> rotation(const Quaternion_t<T>& quaternion) noexcept
+    {
+        const auto x = quaternion.x();
+        const auto y = quaternion.y();
+        const auto z = quaternion.z();
+        const auto w = quaternion.w();
+        const auto xx = x * x;
+        const auto yy = y * y;
+        const auto zz = z * z;
+        const auto xy = x * y;
+        const auto xz = x * z;
+        const auto yz = y * z;
+        const auto wx = w * x;
+        const auto wy = w * y;
+        const auto wz = w * z;
+        return {
+            1 - 2 * (yy + zz), 2 * (xy + wz), 2 * (xz - wy), 0,
+            2 * (xy - wz), 1 - 2 * (xx + zz), 2 * (yz + wx), 0,
+            2 * (xz + wy), 2 * (yz - wx), 1 - 2 * (xx + yy), 0,
+            0, 0, 0, 1};
+    }
+
+    // Unit quaternion of the rotation stored in the upper 3x3 block of an
+    // orthonormal row vector matrix
+    template<typename T>
+    [[nodiscard]] Quaternion_t<T> quaternion_from_matrix(const Matrix4_t<T>& matrix) noexcept
+    {
+        // m(i, j) is the column vector form of the rotation
+        auto m = [&matrix](std::size_t i, std::size_t j) { return matrix[j][i]; };
+        const auto trace = m(0, 0) + m(1, 1) + m(2, 2);
+        if (trace > 0) {
+            const auto s = std::sqrt(trace + 1) * 2;
+            return {(m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, s / 4};
+        }
+        if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+            const auto s = std::sqrt(1 + m(0, 0) - m(1, 1) - m(2, 2)) * 2;
+            return {s / 4, (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s};
+        }
+        if (m(1, 1) > m(2, 2)) {
+            const auto s = std::sqrt(1 + m(1, 1) - m(0, 0) - m(2, 2)) * 2;
+            return {(m(0, 1) + m(1, 0)) / s, s / 4, (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s};
+        }
+        const auto s = std::sqrt(1 + m(2, 2) - m(0, 0) - m(1, 1)) * 2;
+        return {(m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, s / 4, (m(1, 0) - m(0, 1)) / s};
+    }
+
+    // Translation, rotation and scale kept apart. Applied to a point in the
+    // same order as scaling(scale) * rotation(rotation) * translation(translation):
+    // scale first, then rotate, then translate.
+    template<typename T>
+    struct TRS {
+        Vector3_t<T> translation{T{0}, T{0}, T{0}};
+        Quaternion_t<T> rotation = quaternion_identity<T>();
+        Vector3_t<T> scale{T{1}, T{1}, T{1}};
+
+        [[nodiscard]] static constexpr TRS identity() noexcept { return {}; }
+
+        [[nodiscard]] constexpr friend bool operator==(const TRS& lhs, const TRS& rhs) noexcept = default;
+
+        // Fills the matrix directly instead of multiplying the three factors
+        [[nodiscard]] constexpr Matrix4_t<T> to_matrix() const noexcept
+        {
+            auto result = orion::math::rotation(rotation);
+            for (std::size_t i = 0; i < 3; ++i) {
+                for (std::size_t j = 0; j < 3; ++j) {
+                    result[i][j] *= scale[i];
+                }
+                result[3][i] = translation[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr Vector3_t<T> transform_point(const Vector3_t<T>& point) const noexcept
+        {
+            const Vector3_t<T> scaled{point.x() * scale.x(), point.y() * scale.y(), point.z() * scale.z()};
+            return quaternion_rotate(rotation, scaled) + translation;
+        }
+    };
+
+    // Transform applying first, then second; equivalent to first.to_matrix() * second.to_matrix().
+    // The result is exact when second has uniform scale, otherwise the
+    // shear that non-uniform scale after a rotation introduces cannot be represented.
+    template<typename T>
+    [[nodiscard]] constexpr TRS<T> compose(const TRS<T>& first, const TRS<T>& second) noexcept
+    {
+        const auto& first_scale = first.scale;
+        const auto& second_scale = second.scale;
+        return {
+            second.transform_point(first.translation),
+            quaternion_multiply(second.rotation, first.rotation),
+            {first_scale.x() * second_scale.x(), first_scale.y() * second_scale.y(), first_scale.z() * second_scale.z()}};
+    }
+
+    // Linear interpolation of translation and scale, normalized linear
+    // interpolation along the shortest arc for rotation
+    template<typename T>
+    [[nodiscard]] TRS<T> interpolate(const TRS<T>& from, const TRS<T>& to, T t) noexcept
+    {
+        return {lerp(from.translation, to.translation, t), nlerp(from.rotation, to.rotation, t), lerp(from.scale, to.scale, t)};
+    }
+
+    // Splits an affine matrix without shear into translation, rotation and
+    // scale. A negative determinant is folded into the x scale.
+    template<typename T>
+    [[nodiscard]] TRS<T> decompose(const Matrix4_t<T>& matrix) noexcept
+    {
+        TRS<T> result;
+        Matrix4_t<T> rotation_matrix = Matrix4_t<T>::identity();
+        for (std::size_t i = 0; i < 3; ++i) {
+            const Vector3_t<T> row{matrix[i][0], matrix[i][1], matrix[i][2]};
+            result.scale[i] = std::sqrt(row.sqr_magnitude());
+            for (std::size_t j = 0; j < 3; ++j) {
+                rotation_matrix[i][j] = row[j] / result.scale[i];
+            }
+            result.translation[i] = matrix[3][i];
+        }
+
+        const Vector3_t<T> x_axis{rotation_matrix[0][0], rotation_matrix[0][1], rotation_matrix[0][2]};
+        const Vector3_t<T> y_axis{rotation_matrix[1][0], rotation_matrix[1][1], rotation_matrix[1][2]};
+        const Vector3_t<T> z_axis{rotation_matrix[2][0], rotation_matrix[2][1], rotation_matrix[2][2]};
+        if (dot(cross(x_axis, y_axis), z_axis) < 0) {
+            result.scale[0] = -result.scale[0];
+            for (std::size_t j = 0; j < 3; ++j) {
+                rotation_matrix[0][j] = -rotation_matrix[0][j];
+            }
+        }
+
+        result.rotation = quaternion_from_matrix(rotation_matrix);
+        return result;
+    }
+} // namespace orion::math
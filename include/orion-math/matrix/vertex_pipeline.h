@@ -0,0 +1,209 @@
+#pragma once
+
+#include "matrix4.h"
+#include "orion-math/fma.h"        // fmadd
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_chunk_count, parallel_for
+#include "orion-math/simd.h"       // simd::Pack
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Outcode bits of a clip space position against the clip volume of the
+    // projections in transformation.h: -w <= x <= w, -w <= y <= w, 0 <= z <= w
+    inline constexpr std::uint8_t clip_left = 1U << 0;
+    inline constexpr std::uint8_t clip_right = 1U << 1;
+    inline constexpr std::uint8_t clip_bottom = 1U << 2;
+    inline constexpr std::uint8_t clip_top = 1U << 3;
+    inline constexpr std::uint8_t clip_near = 1U << 4;
+    inline constexpr std::uint8_t clip_far = 1U << 5;
+
+    template<typename T>
+    [[nodiscard]] constexpr std::uint8_t clip_outcode(const Vector4_t<T>& clip) noexcept
+    {
+        const auto w = clip[3];
+        return static_cast<std::uint8_t>(
+            (clip[0] < -w ? clip_left : 0U) |
+            (clip[0] > w ? clip_right : 0U) |
+            (clip[1] < -w ? clip_bottom : 0U) |
+            (clip[1] > w ? clip_top : 0U) |
+            (clip[2] < T{0} ? clip_near : 0U) |
+            (clip[2] > w ? clip_far : 0U));
+    }
+
+    // Window rectangle in pixels with y pointing down, and the depth range NDC z maps to
+    template<typename T>
+    struct Viewport {
+        T x{0};
+        T y{0};
+        T width{1};
+        T height{1};
+        T min_depth{0};
+        T max_depth{1};
+    };
+
+    // Outputs of project_vertices. Any of them may be empty to skip that stage's store.
+    template<typename T>
+    struct ProjectedVertices {
+        std::span<Vector4_t<T>> clip{};
+        std::span<std::uint8_t> outcodes{};
+        std::span<Vector3_t<T>> ndc{};
+        std::span<Vector3_t<T>> screen{};
+    };
+
+    // Union and intersection of all outcodes of a batch. A nonzero intersection
+    // means every vertex lies outside the same plane and the batch can be culled,
+    // a zero union means no vertex needs clipping.
+    struct OutcodeSummary {
+        std::uint8_t any = 0;
+        std::uint8_t all = 0;
+    };
+
+    namespace detail
+    {
+        template<typename T>
+        struct VertexPipelineJob {
+            std::span<const Vector3_t<T>> positions;
+            const Matrix4_t<T>& mvp;
+            const Viewport<T>& viewport;
+            const ProjectedVertices<T>& output;
+        };
+
+        template<typename T>
+        void store_vertex(const VertexPipelineJob<T>& job, std::size_t vertex, const Vector4_t<T>& clip, const Vector3_t<T>& ndc, const Vector3_t<T>& screen, OutcodeSummary& summary) noexcept
+        {
+            const auto outcode = clip_outcode(clip);
+            summary.any |= outcode;
+            summary.all &= outcode;
+            if (!job.output.clip.empty()) {
+                job.output.clip[vertex] = clip;
+            }
+            if (!job.output.outcodes.empty()) {
+                job.output.outcodes[vertex] = outcode;
+            }
+            if (!job.output.ndc.empty()) {
+                job.output.ndc[vertex] = ndc;
+            }
+            if (!job.output.screen.empty()) {
+                job.output.screen[vertex] = screen;
+            }
+        }
+
+        // Four vertices per iteration with one vertex per lane, so the matrix
+        // product, the divide and the viewport mapping are all packed operations
+        template<typename T>
+        [[nodiscard]] OutcodeSummary project_range(const VertexPipelineJob<T>& job, std::size_t begin, std::size_t end) noexcept
+        {
+            using Pack = simd::Pack<T, 4>;
+            constexpr auto lanes = Pack::lanes;
+            const auto& m = job.mvp;
+            const auto& viewport = job.viewport;
+            const auto half_width = viewport.width / T{2};
+            const auto half_height = viewport.height / T{2};
+            const auto depth_range = viewport.max_depth - viewport.min_depth;
+
+            OutcodeSummary summary{0, static_cast<std::uint8_t>(~0U)};
+            auto vertex = begin;
+            for (; vertex + lanes <= end; vertex += lanes) {
+                std::array<std::array<T, lanes>, 3> position;
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    for (std::size_t component = 0; component < 3; ++component) {
+                        position[component][lane] = job.positions[vertex + lane][component];
+                    }
+                }
+                const auto x = Pack::load(position[0].data());
+                const auto y = Pack::load(position[1].data());
+                const auto z = Pack::load(position[2].data());
+
+                std::array<Pack, 4> clip;
+                for (std::size_t column = 0; column < 4; ++column) {
+                    clip[column] = fmadd(x, Pack::broadcast(m[0][column]), fmadd(y, Pack::broadcast(m[1][column]), fmadd(z, Pack::broadcast(m[2][column]), Pack::broadcast(m[3][column]))));
+                }
+                const auto inverse_w = Pack::broadcast(T{1}) / clip[3];
+                const auto ndc_x = clip[0] * inverse_w;
+                const auto ndc_y = clip[1] * inverse_w;
+                const auto ndc_z = clip[2] * inverse_w;
+
+                // Lanes go back to memory once and are scattered into the AoS outputs from there
+                std::array<std::array<T, lanes>, 4> clip_lanes;
+                std::array<std::array<T, lanes>, 3> ndc_lanes;
+                std::array<std::array<T, lanes>, 3> screen_lanes;
+                for (std::size_t component = 0; component < 4; ++component) {
+                    clip[component].store(clip_lanes[component].data());
+                }
+                ndc_x.store(ndc_lanes[0].data());
+                ndc_y.store(ndc_lanes[1].data());
+                ndc_z.store(ndc_lanes[2].data());
+                fmadd(ndc_x + Pack::broadcast(T{1}), Pack::broadcast(half_width), Pack::broadcast(viewport.x)).store(screen_lanes[0].data());
+                fmadd(Pack::broadcast(T{1}) - ndc_y, Pack::broadcast(half_height), Pack::broadcast(viewport.y)).store(screen_lanes[1].data());
+                fmadd(ndc_z, Pack::broadcast(depth_range), Pack::broadcast(viewport.min_depth)).store(screen_lanes[2].data());
+
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    store_vertex(job, vertex + lane,
+                                 {clip_lanes[0][lane], clip_lanes[1][lane], clip_lanes[2][lane], clip_lanes[3][lane]},
+                                 {ndc_lanes[0][lane], ndc_lanes[1][lane], ndc_lanes[2][lane]},
+                                 {screen_lanes[0][lane], screen_lanes[1][lane], screen_lanes[2][lane]},
+                                 summary);
+                }
+            }
+            for (; vertex < end; ++vertex) {
+                const auto& p = job.positions[vertex];
+                Vector4_t<T> clip;
+                for (std::size_t column = 0; column < 4; ++column) {
+                    clip[column] = fmadd(p[0], m[0][column], fmadd(p[1], m[1][column], fmadd(p[2], m[2][column], m[3][column])));
+                }
+                const auto inverse_w = T{1} / clip[3];
+                const Vector3_t<T> ndc{clip[0] * inverse_w, clip[1] * inverse_w, clip[2] * inverse_w};
+                const Vector3_t<T> screen{
+                    fmadd(ndc[0] + T{1}, half_width, viewport.x),
+                    fmadd(T{1} - ndc[1], half_height, viewport.y),
+                    fmadd(ndc[2], depth_range, viewport.min_depth)};
+                store_vertex(job, vertex, clip, ndc, screen, summary);
+            }
+            return summary;
+        }
+    } // namespace detail
+
+    // Runs object space positions through a combined model-view-projection
+    // matrix (row vector convention, v * M) and produces clip space positions,
+    // outcodes, NDC after the perspective divide and viewport mapped screen
+    // coordinates in one pass. NDC and screen values are only meaningful for
+    // vertices in front of the camera, clip_near is set for the others.
+    // Throws std::invalid_argument when a non-empty output does not match the vertex count.
+    template<typename T = float>
+    OutcodeSummary project_vertices(std::type_identity_t<std::span<const Vector3_t<T>>> positions,
+                                    const std::type_identity_t<Matrix4_t<T>>& mvp,
+                                    const std::type_identity_t<Viewport<T>>& viewport,
+                                    const std::type_identity_t<ProjectedVertices<T>>& output,
+                                    unsigned thread_count = 1)
+    {
+        const auto count = positions.size();
+        auto matches = [count](std::size_t size) { return size == 0 || size == count; };
+        if (!matches(output.clip.size()) || !matches(output.outcodes.size()) || !matches(output.ndc.size()) || !matches(output.screen.size())) {
+            throw std::invalid_argument("vertex outputs must be empty or match the vertex count");
+        }
+
+        ORION_MATH_INSTRUMENT_BATCH(count);
+        const detail::VertexPipelineJob<T> job{positions, mvp, viewport, output};
+        std::vector<OutcodeSummary> chunk_summaries(parallel_chunk_count(count, thread_count), OutcodeSummary{0, static_cast<std::uint8_t>(~0U)});
+        parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+            chunk_summaries[chunk] = detail::project_range(job, begin, end);
+        });
+
+        OutcodeSummary summary{0, count == 0 ? std::uint8_t{0} : static_cast<std::uint8_t>(~0U)};
+        for (const auto& chunk : chunk_summaries) {
+            summary.any |= chunk.any;
+            summary.all &= chunk.all;
+        }
+        return summary;
+    }
+} // namespace orion::math
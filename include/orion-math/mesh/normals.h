@@ -0,0 +1,233 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for
+#include "orion-math/simd.h"       // simd::Pack
+#include "orion-math/vector/vector2.h"
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+
+#include <algorithm>   // std::clamp
+#include <array>       // std::array
+#include <cmath>       // std::acos, std::sqrt
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <limits>      // std::numeric_limits
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument, std::out_of_range
+#include <type_traits> // std::type_identity_t
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    namespace detail
+    {
+        // Triangle corners grouped by vertex in compressed sparse row form. The
+        // corners of vertex v are corners[offsets[v]] up to corners[offsets[v + 1]],
+        // each stored as triangle * 3 + corner. Every vertex gathers from its own
+        // triangles, so threads never write to the same output.
+        struct VertexCorners {
+            std::vector<std::uint32_t> offsets;
+            std::vector<std::uint32_t> corners;
+        };
+
+        [[nodiscard]] inline VertexCorners vertex_corners(std::span<const std::uint32_t> indices, std::size_t vertex_count)
+        {
+            if (indices.size() % 3 != 0) {
+                throw std::invalid_argument("index count must be a multiple of 3");
+            }
+
+            VertexCorners result;
+            result.offsets.assign(vertex_count + 1, 0);
+            for (const auto index : indices) {
+                if (index >= vertex_count) {
+                    throw std::out_of_range("vertex index out of range");
+                }
+                ++result.offsets[index + 1];
+            }
+            for (std::size_t vertex = 0; vertex < vertex_count; ++vertex) {
+                result.offsets[vertex + 1] += result.offsets[vertex];
+            }
+
+            result.corners.resize(indices.size());
+            auto cursor = result.offsets;
+            for (std::size_t corner = 0; corner < indices.size(); ++corner) {
+                result.corners[cursor[indices[corner]]++] = static_cast<std::uint32_t>(corner);
+            }
+            return result;
+        }
+
+        // Normalizes vectors four at a time. The smallest normal value added to
+        // the squared length keeps zero vectors at zero instead of turning them into NaN.
+        template<typename T>
+        void normalize_range(std::span<Vector3_t<T>> vectors, std::size_t begin, std::size_t end) noexcept
+        {
+            using Lanes = simd::Pack<T, 4>;
+            const auto bias = Lanes::broadcast(std::numeric_limits<T>::min());
+            const auto one = Lanes::broadcast(T{1});
+
+            auto i = begin;
+            for (; i + Lanes::lanes <= end; i += Lanes::lanes) {
+                std::array<T, Lanes::lanes> x;
+                std::array<T, Lanes::lanes> y;
+                std::array<T, Lanes::lanes> z;
+                for (std::size_t lane = 0; lane < Lanes::lanes; ++lane) {
+                    x[lane] = vectors[i + lane][0];
+                    y[lane] = vectors[i + lane][1];
+                    z[lane] = vectors[i + lane][2];
+                }
+                const auto xs = Lanes::load(x.data());
+                const auto ys = Lanes::load(y.data());
+                const auto zs = Lanes::load(z.data());
+                const auto inverse_length = one / sqrt(fmadd(xs, xs, fmadd(ys, ys, fmadd(zs, zs, bias))));
+                (xs * inverse_length).store(x.data());
+                (ys * inverse_length).store(y.data());
+                (zs * inverse_length).store(z.data());
+                for (std::size_t lane = 0; lane < Lanes::lanes; ++lane) {
+                    vectors[i + lane] = {x[lane], y[lane], z[lane]};
+                }
+            }
+            for (; i < end; ++i) {
+                vectors[i] = vectors[i] / std::sqrt(vectors[i].sqr_magnitude() + std::numeric_limits<T>::min());
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] Vector3_t<T> normalize_or_zero(const Vector3_t<T>& vector) noexcept
+        {
+            return vector / std::sqrt(vector.sqr_magnitude() + std::numeric_limits<T>::min());
+        }
+
+        // Tangent frame of one triangle: the texture space directions normalized
+        // and flipped for mirrored UVs, plus the interior angle at each corner
+        // used as its weight
+        template<typename T>
+        struct FaceTangent {
+            Vector3_t<T> tangent;
+            Vector3_t<T> bitangent;
+            std::array<T, 3> angles;
+        };
+
+        template<typename T>
+        [[nodiscard]] FaceTangent<T> face_tangent(const std::array<Vector3_t<T>, 3>& positions, const std::array<Vector2_t<T>, 3>& uvs) noexcept
+        {
+            const auto edge1 = positions[1] - positions[0];
+            const auto edge2 = positions[2] - positions[0];
+            const auto uv1 = uvs[1] - uvs[0];
+            const auto uv2 = uvs[2] - uvs[0];
+
+            FaceTangent<T> result{};
+            const auto signed_area = uv1.x() * uv2.y() - uv2.x() * uv1.y();
+            if (signed_area > std::numeric_limits<T>::min() || signed_area < -std::numeric_limits<T>::min()) {
+                const auto sign = signed_area > 0 ? T{1} : T{-1};
+                result.tangent = normalize_or_zero<T>((edge1 * uv2.y() - edge2 * uv1.y()) * sign);
+                result.bitangent = normalize_or_zero<T>((edge2 * uv1.x() - edge1 * uv2.x()) * sign);
+            }
+
+            for (std::size_t corner = 0; corner < 3; ++corner) {
+                const auto& origin = positions[corner];
+                const auto to_next = normalize_or_zero<T>(positions[(corner + 1) % 3] - origin);
+                const auto to_previous = normalize_or_zero<T>(positions[(corner + 2) % 3] - origin);
+                result.angles[corner] = std::acos(std::clamp(dot(to_next, to_previous), T{-1}, T{1}));
+            }
+            return result;
+        }
+
+        // Removes the component along normal and normalizes the rest
+        template<typename T>
+        [[nodiscard]] Vector3_t<T> orthogonalize(const Vector3_t<T>& vector, const Vector3_t<T>& normal) noexcept
+        {
+            return normalize_or_zero<T>(vector - normal * dot(normal, vector));
+        }
+    } // namespace detail
+
+    // Area weighted vertex normals of an indexed triangle list with counter
+    // clockwise front faces. Vertices no triangle references get a zero normal.
+    template<typename T = float>
+    void compute_normals(std::type_identity_t<std::span<const Vector3_t<T>>> positions,
+                         std::span<const std::uint32_t> indices,
+                         std::type_identity_t<std::span<Vector3_t<T>>> normals,
+                         unsigned thread_count = 1)
+    {
+        if (normals.size() != positions.size()) {
+            throw std::invalid_argument("normal span must match the vertex count");
+        }
+        const auto corners = detail::vertex_corners(indices, positions.size());
+        ORION_MATH_INSTRUMENT_BATCH(positions.size());
+
+        // The cross product is twice the triangle area long, summing them unnormalized weights by area
+        const auto triangle_count = indices.size() / 3;
+        std::vector<Vector3_t<T>> face_normals(triangle_count);
+        parallel_for(triangle_count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t triangle = begin; triangle < end; ++triangle) {
+                const auto& p0 = positions[indices[triangle * 3]];
+                const auto& p1 = positions[indices[triangle * 3 + 1]];
+                const auto& p2 = positions[indices[triangle * 3 + 2]];
+                face_normals[triangle] = cross(p1 - p0, p2 - p0);
+            }
+        });
+
+        parallel_for(positions.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t vertex = begin; vertex < end; ++vertex) {
+                Vector3_t<T> sum{T{0}, T{0}, T{0}};
+                for (auto i = corners.offsets[vertex]; i < corners.offsets[vertex + 1]; ++i) {
+                    sum = sum + face_normals[corners.corners[i] / 3];
+                }
+                normals[vertex] = sum;
+            }
+            detail::normalize_range<T>(normals, begin, end);
+        });
+    }
+
+    // Per-vertex tangents on the existing vertices: face tangents are projected
+    // onto the plane of each corner's normal and weighted by the corner angle.
+    // w holds the bitangent sign, so bitangent = cross(normal, tangent.xyz) * tangent.w.
+    // This is not MikkTSpace and will not match normal maps baked with it.
+    // Vertices are never split, so a vertex shared by mirrored and non-mirrored
+    // triangles gets the handedness of the larger angle-weighted bitangent, and
+    // tangents are averaged across UV seams that share a vertex. Split such
+    // vertices beforehand when that matters.
+    template<typename T = float>
+    void compute_angle_weighted_tangents(std::type_identity_t<std::span<const Vector3_t<T>>> positions,
+                          std::type_identity_t<std::span<const Vector3_t<T>>> normals,
+                          std::type_identity_t<std::span<const Vector2_t<T>>> uvs,
+                          std::span<const std::uint32_t> indices,
+                          std::type_identity_t<std::span<Vector4_t<T>>> tangents,
+                          unsigned thread_count = 1)
+    {
+        const auto count = positions.size();
+        if (normals.size() != count || uvs.size() != count || tangents.size() != count) {
+            throw std::invalid_argument("tangent spans must have the same size");
+        }
+        const auto corners = detail::vertex_corners(indices, count);
+        ORION_MATH_INSTRUMENT_BATCH(count);
+
+        const auto triangle_count = indices.size() / 3;
+        std::vector<detail::FaceTangent<T>> faces(triangle_count);
+        parallel_for(triangle_count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t triangle = begin; triangle < end; ++triangle) {
+                const auto* corner = &indices[triangle * 3];
+                faces[triangle] = detail::face_tangent<T>(
+                    {positions[corner[0]], positions[corner[1]], positions[corner[2]]},
+                    {uvs[corner[0]], uvs[corner[1]], uvs[corner[2]]});
+            }
+        });
+
+        parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t vertex = begin; vertex < end; ++vertex) {
+                const auto& normal = normals[vertex];
+                Vector3_t<T> tangent{T{0}, T{0}, T{0}};
+                Vector3_t<T> bitangent{T{0}, T{0}, T{0}};
+                for (auto i = corners.offsets[vertex]; i < corners.offsets[vertex + 1]; ++i) {
+                    const auto& face = faces[corners.corners[i] / 3];
+                    const auto weight = face.angles[corners.corners[i] % 3];
+                    tangent = tangent + detail::orthogonalize(face.tangent, normal) * weight;
+                    bitangent = bitangent + detail::orthogonalize(face.bitangent, normal) * weight;
+                }
+                tangent = detail::orthogonalize(tangent, normal);
+                const auto handedness = dot(cross(normal, tangent), bitangent) < 0 ? T{-1} : T{1};
+                tangents[vertex] = {tangent.x(), tangent.y(), tangent.z(), handedness};
+            }
+        });
+    }
+} // namespace orion::math
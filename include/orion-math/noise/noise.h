@@ -0,0 +1,845 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for
+#include "orion-math/simd.h"       // simd::Pack, simd::Mask, simd::convert, ORION_MATH_SSE2, ORION_MATH_AVX2
+#include "orion-math/vector/vector2.h"
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+#include "orion-math/vector/wide.h" // WideVector
+
+#include <algorithm>   // std::copy_n
+#include <array>       // std::array
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::int32_t, std::uint32_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::is_same_v, std::type_identity_t
+
+namespace orion::math
+{
+    enum class NoiseType {
+        // Improved Perlin gradient noise on the integer lattice
+        perlin,
+        // Simplex noise, fewer corners per sample and no axis aligned artifacts
+        simplex,
+    };
+
+    // Fractal sum of octaves. Each octave multiplies the frequency by lacunarity
+    // and the amplitude by gain; the sum is divided by the total amplitude so it
+    // stays in the range of a single octave.
+    template<typename T>
+    struct FbmSettings {
+        std::size_t octaves = 5;
+        T lacunarity = T{2};
+        T gain = T{.5};
+    };
+
+    // Gradients are picked by hashing lattice coordinates instead of indexing a
+    // permutation table, so every sample function has a WideVector overload
+    // below that runs the same arithmetic on simd::Pack lanes, and the batch
+    // functions process noise_batch_lanes samples per iteration.
+    // Gradient sets and output scales follow Stefan Gustavson's reference implementations.
+    namespace detail
+    {
+        [[nodiscard]] constexpr std::int32_t fast_floor(auto value) noexcept
+        {
+            const auto truncated = static_cast<std::int32_t>(value);
+            return truncated - static_cast<std::int32_t>(value < static_cast<decltype(value)>(truncated));
+        }
+
+        [[nodiscard]] constexpr std::uint32_t hash_lattice(std::uint32_t seed, std::int32_t x, std::int32_t y, std::int32_t z = 0, std::int32_t w = 0) noexcept
+        {
+            auto hash = seed ^
+                        (static_cast<std::uint32_t>(x) * 0x8da6b343U) ^
+                        (static_cast<std::uint32_t>(y) * 0xd8163841U) ^
+                        (static_cast<std::uint32_t>(z) * 0xcb1ab31fU) ^
+                        (static_cast<std::uint32_t>(w) * 0x165667b1U);
+            hash ^= hash >> 15;
+            hash *= 0x2c1b3c6dU;
+            hash ^= hash >> 12;
+            hash *= 0x297a2d39U;
+            hash ^= hash >> 15;
+            return hash;
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr T gradient(std::uint32_t hash, T x, T y) noexcept
+        {
+            const auto h = hash & 7U;
+            const auto u = h < 4 ? x : y;
+            const auto v = h < 4 ? y : x;
+            return ((h & 1U) != 0 ? -u : u) + ((h & 2U) != 0 ? T{-2} * v : T{2} * v);
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr T gradient(std::uint32_t hash, T x, T y, T z) noexcept
+        {
+            const auto h = hash & 15U;
+            const auto u = h < 8 ? x : y;
+            const auto v = h < 4 ? y : (h == 12 || h == 14 ? x : z);
+            return ((h & 1U) != 0 ? -u : u) + ((h & 2U) != 0 ? -v : v);
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr T gradient(std::uint32_t hash, T x, T y, T z, T w) noexcept
+        {
+            const auto h = hash & 31U;
+            const auto u = h < 24 ? x : y;
+            const auto v = h < 16 ? y : z;
+            const auto s = h < 8 ? z : w;
+            return ((h & 1U) != 0 ? -u : u) + ((h & 2U) != 0 ? -v : v) + ((h & 4U) != 0 ? -s : s);
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr T fade(T t) noexcept
+        {
+            return t * t * t * (t * (t * T{6} - T{15}) + T{10});
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr T mix(T from, T to, T t) noexcept
+        {
+            return from + (to - from) * t;
+        }
+
+        // Falloff of one simplex corner, zero outside its radius
+        template<typename T>
+        [[nodiscard]] constexpr T corner_weight(T radius_squared, T distance_squared) noexcept
+        {
+            auto t = radius_squared - distance_squared;
+            t = t < T{0} ? T{0} : t;
+            t *= t;
+            return t * t;
+        }
+    } // namespace detail
+
+    template<typename T>
+    [[nodiscard]] constexpr T perlin(const Vector2_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        const auto ix = detail::fast_floor(point[0]);
+        const auto iy = detail::fast_floor(point[1]);
+        const auto fx = point[0] - static_cast<T>(ix);
+        const auto fy = point[1] - static_cast<T>(iy);
+
+        const auto n00 = detail::gradient(detail::hash_lattice(seed, ix, iy), fx, fy);
+        const auto n10 = detail::gradient(detail::hash_lattice(seed, ix + 1, iy), fx - T{1}, fy);
+        const auto n01 = detail::gradient(detail::hash_lattice(seed, ix, iy + 1), fx, fy - T{1});
+        const auto n11 = detail::gradient(detail::hash_lattice(seed, ix + 1, iy + 1), fx - T{1}, fy - T{1});
+
+        const auto u = detail::fade(fx);
+        const auto v = detail::fade(fy);
+        return static_cast<T>(.507) * detail::mix(detail::mix(n00, n10, u), detail::mix(n01, n11, u), v);
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr T perlin(const Vector3_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        const auto ix = detail::fast_floor(point[0]);
+        const auto iy = detail::fast_floor(point[1]);
+        const auto iz = detail::fast_floor(point[2]);
+        const auto fx = point[0] - static_cast<T>(ix);
+        const auto fy = point[1] - static_cast<T>(iy);
+        const auto fz = point[2] - static_cast<T>(iz);
+
+        auto corner = [&](std::int32_t dx, std::int32_t dy, std::int32_t dz) {
+            return detail::gradient(detail::hash_lattice(seed, ix + dx, iy + dy, iz + dz),
+                                    fx - static_cast<T>(dx), fy - static_cast<T>(dy), fz - static_cast<T>(dz));
+        };
+
+        const auto u = detail::fade(fx);
+        const auto v = detail::fade(fy);
+        const auto w = detail::fade(fz);
+        const auto near = detail::mix(detail::mix(corner(0, 0, 0), corner(1, 0, 0), u), detail::mix(corner(0, 1, 0), corner(1, 1, 0), u), v);
+        const auto far = detail::mix(detail::mix(corner(0, 0, 1), corner(1, 0, 1), u), detail::mix(corner(0, 1, 1), corner(1, 1, 1), u), v);
+        return static_cast<T>(.936) * detail::mix(near, far, w);
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr T perlin(const Vector4_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        std::int32_t cell[4];
+        T offset[4];
+        T fades[4];
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            cell[axis] = detail::fast_floor(point[axis]);
+            offset[axis] = point[axis] - static_cast<T>(cell[axis]);
+            fades[axis] = detail::fade(offset[axis]);
+        }
+
+        // Corner c has bit a set when it sits on the far side of axis a; the
+        // corners are folded pairwise along x, y, z and finally w
+        T values[16];
+        for (std::int32_t c = 0; c < 16; ++c) {
+            const auto dx = c & 1;
+            const auto dy = (c >> 1) & 1;
+            const auto dz = (c >> 2) & 1;
+            const auto dw = (c >> 3) & 1;
+            values[c] = detail::gradient(detail::hash_lattice(seed, cell[0] + dx, cell[1] + dy, cell[2] + dz, cell[3] + dw),
+                                         offset[0] - static_cast<T>(dx), offset[1] - static_cast<T>(dy),
+                                         offset[2] - static_cast<T>(dz), offset[3] - static_cast<T>(dw));
+        }
+        for (std::size_t axis = 0, count = 16; axis < 4; ++axis, count /= 2) {
+            for (std::size_t c = 0; c < count / 2; ++c) {
+                values[c] = detail::mix(values[c * 2], values[c * 2 + 1], fades[axis]);
+            }
+        }
+        return static_cast<T>(.87) * values[0];
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr T simplex(const Vector2_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        constexpr auto skew = static_cast<T>(.366025403784438647);   // (sqrt(3) - 1) / 2
+        constexpr auto unskew = static_cast<T>(.211324865405187118); // (3 - sqrt(3)) / 6
+
+        const auto s = (point[0] + point[1]) * skew;
+        const auto i = detail::fast_floor(point[0] + s);
+        const auto j = detail::fast_floor(point[1] + s);
+        const auto t = static_cast<T>(i + j) * unskew;
+        const auto x0 = point[0] - (static_cast<T>(i) - t);
+        const auto y0 = point[1] - (static_cast<T>(j) - t);
+
+        const std::int32_t i1 = x0 > y0 ? 1 : 0;
+        const std::int32_t j1 = 1 - i1;
+        const auto x1 = x0 - static_cast<T>(i1) + unskew;
+        const auto y1 = y0 - static_cast<T>(j1) + unskew;
+        const auto x2 = x0 - T{1} + T{2} * unskew;
+        const auto y2 = y0 - T{1} + T{2} * unskew;
+
+        const auto n0 = detail::corner_weight(T{.5}, x0 * x0 + y0 * y0) * detail::gradient(detail::hash_lattice(seed, i, j), x0, y0);
+        const auto n1 = detail::corner_weight(T{.5}, x1 * x1 + y1 * y1) * detail::gradient(detail::hash_lattice(seed, i + i1, j + j1), x1, y1);
+        const auto n2 = detail::corner_weight(T{.5}, x2 * x2 + y2 * y2) * detail::gradient(detail::hash_lattice(seed, i + 1, j + 1), x2, y2);
+        return T{40} * (n0 + n1 + n2);
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr T simplex(const Vector3_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        constexpr auto skew = T{1} / T{3};
+        constexpr auto unskew = T{1} / T{6};
+
+        const auto s = (point[0] + point[1] + point[2]) * skew;
+        const auto i = detail::fast_floor(point[0] + s);
+        const auto j = detail::fast_floor(point[1] + s);
+        const auto k = detail::fast_floor(point[2] + s);
+        const auto t = static_cast<T>(i + j + k) * unskew;
+        const auto x0 = point[0] - (static_cast<T>(i) - t);
+        const auto y0 = point[1] - (static_cast<T>(j) - t);
+        const auto z0 = point[2] - (static_cast<T>(k) - t);
+
+        // Rank of each axis among the offsets picks the simplex without nested branches
+        const std::int32_t rank_x = (x0 > y0 ? 1 : 0) + (x0 > z0 ? 1 : 0);
+        const std::int32_t rank_y = (y0 >= x0 ? 1 : 0) + (y0 > z0 ? 1 : 0);
+        const std::int32_t rank_z = (z0 >= x0 ? 1 : 0) + (z0 >= y0 ? 1 : 0);
+
+        auto contribution = [&](std::int32_t di, std::int32_t dj, std::int32_t dk, T corner) {
+            const auto x = x0 - static_cast<T>(di) + corner * unskew;
+            const auto y = y0 - static_cast<T>(dj) + corner * unskew;
+            const auto z = z0 - static_cast<T>(dk) + corner * unskew;
+            return detail::corner_weight(T{.6}, x * x + y * y + z * z) * detail::gradient(detail::hash_lattice(seed, i + di, j + dj, k + dk), x, y, z);
+        };
+
+        return T{32} * (contribution(0, 0, 0, T{0}) +
+                         contribution(rank_x >= 2, rank_y >= 2, rank_z >= 2, T{1}) +
+                         contribution(rank_x >= 1, rank_y >= 1, rank_z >= 1, T{2}) +
+                         contribution(1, 1, 1, T{3}));
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr T simplex(const Vector4_t<T>& point, std::uint32_t seed = 0) noexcept
+    {
+        constexpr auto skew = static_cast<T>(.309016994374947451);   // (sqrt(5) - 1) / 4
+        constexpr auto unskew = static_cast<T>(.138196601125010504); // (5 - sqrt(5)) / 20
+
+        const auto s = (point[0] + point[1] + point[2] + point[3]) * skew;
+        std::int32_t cell[4];
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            cell[axis] = detail::fast_floor(point[axis] + s);
+        }
+        const auto t = static_cast<T>(cell[0] + cell[1] + cell[2] + cell[3]) * unskew;
+        T offset[4];
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            offset[axis] = point[axis] - (static_cast<T>(cell[axis]) - t);
+        }
+
+        // Ties are broken towards the lower axis, which keeps the ranks a permutation of 0..3
+        std::int32_t rank[4] = {0, 0, 0, 0};
+        for (std::size_t a = 0; a < 4; ++a) {
+            for (std::size_t b = a + 1; b < 4; ++b) {
+                const std::int32_t a_first = offset[a] > offset[b] ? 1 : 0;
+                rank[a] += a_first;
+                rank[b] += 1 - a_first;
+            }
+        }
+
+        T result{0};
+        for (std::int32_t corner = 0; corner < 5; ++corner) {
+            std::int32_t step[4];
+            T position[4];
+            T distance_squared{0};
+            for (std::size_t axis = 0; axis < 4; ++axis) {
+                step[axis] = rank[axis] >= 4 - corner ? 1 : 0;
+                position[axis] = offset[axis] - static_cast<T>(step[axis]) + static_cast<T>(corner) * unskew;
+                distance_squared += position[axis] * position[axis];
+            }
+            result += detail::corner_weight(T{.6}, distance_squared) *
+                      detail::gradient(detail::hash_lattice(seed, cell[0] + step[0], cell[1] + step[1], cell[2] + step[2], cell[3] + step[3]),
+                                       position[0], position[1], position[2], position[3]);
+        }
+        return T{27} * result;
+    }
+
+    template<NoiseType Type, typename T, std::size_t N>
+    [[nodiscard]] constexpr T noise(const Vector<T, N>& point, std::uint32_t seed = 0) noexcept
+    {
+        if constexpr (Type == NoiseType::perlin) {
+            return perlin(point, seed);
+        } else {
+            return simplex(point, seed);
+        }
+    }
+
+    // Every octave uses its own seed so lattice features do not line up across octaves
+    template<NoiseType Type, typename T, std::size_t N>
+    [[nodiscard]] constexpr T fbm(const Vector<T, N>& point, const FbmSettings<T>& settings = {}, std::uint32_t seed = 0) noexcept
+    {
+        T sum{0};
+        T amplitude{1};
+        T total_amplitude{0};
+        T frequency{1};
+        for (std::size_t octave = 0; octave < settings.octaves; ++octave) {
+            sum += amplitude * noise<Type>(point * frequency, seed + static_cast<std::uint32_t>(octave));
+            total_amplitude += amplitude;
+            amplitude *= settings.gain;
+            frequency *= settings.lacunarity;
+        }
+        return total_amplitude > T{0} ? sum / total_amplitude : T{0};
+    }
+
+    // Lane-wise versions of the helpers above. Lattice coordinates and hashes
+    // are uint32 packs so they wrap like the scalar casts do; hash fields used
+    // for gradient selection are converted to T and compared there.
+    namespace detail
+    {
+        template<std::size_t Lanes>
+        using LatticePack = simd::Pack<std::uint32_t, Lanes>;
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> floor(const simd::Pack<T, Lanes>& value) noexcept
+        {
+            const auto truncated = simd::convert<T>(simd::convert<std::int32_t>(value));
+            return select(value < truncated, truncated - simd::Pack<T, Lanes>::broadcast(T{1}), truncated);
+        }
+
+        // Lattice coordinates of lanes that hold whole numbers
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline LatticePack<Lanes> lattice(const simd::Pack<T, Lanes>& value) noexcept
+        {
+            return simd::convert<std::uint32_t>(simd::convert<std::int32_t>(value));
+        }
+
+        template<std::size_t Lanes>
+        [[nodiscard]] inline LatticePack<Lanes> hash_lattice(std::uint32_t seed,
+                                                             const LatticePack<Lanes>& x,
+                                                             const LatticePack<Lanes>& y,
+                                                             const LatticePack<Lanes>& z = LatticePack<Lanes>::broadcast(0),
+                                                             const LatticePack<Lanes>& w = LatticePack<Lanes>::broadcast(0)) noexcept
+        {
+            using Lattice = LatticePack<Lanes>;
+            auto hash = Lattice::broadcast(seed) ^
+                        (x * Lattice::broadcast(0x8da6b343U)) ^
+                        (y * Lattice::broadcast(0xd8163841U)) ^
+                        (z * Lattice::broadcast(0xcb1ab31fU)) ^
+                        (w * Lattice::broadcast(0x165667b1U));
+            hash = hash ^ (hash >> 15);
+            hash = hash * Lattice::broadcast(0x2c1b3c6dU);
+            hash = hash ^ (hash >> 12);
+            hash = hash * Lattice::broadcast(0x297a2d39U);
+            hash = hash ^ (hash >> 15);
+            return hash;
+        }
+
+        // hash & mask as T, through int32 which converts in one instruction where uint32 does not
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> hash_field(const LatticePack<Lanes>& hash, std::uint32_t mask) noexcept
+        {
+            return simd::convert<T>(simd::convert<std::int32_t>(hash & LatticePack<Lanes>::broadcast(mask)));
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Mask<T, Lanes> hash_bit(const LatticePack<Lanes>& hash, std::uint32_t bit) noexcept
+        {
+            return hash_field<T>(hash, bit) != simd::Pack<T, Lanes>::broadcast(T{0});
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> gradient(const LatticePack<Lanes>& hash, const simd::Pack<T, Lanes>& x, const simd::Pack<T, Lanes>& y) noexcept
+        {
+            using Pack = simd::Pack<T, Lanes>;
+            const auto low = hash_field<T>(hash, 7U) < Pack::broadcast(T{4});
+            const auto u = select(low, x, y);
+            const auto v = select(low, y, x);
+            return select(hash_bit<T>(hash, 1U), -u, u) + select(hash_bit<T>(hash, 2U), Pack::broadcast(T{-2}) * v, Pack::broadcast(T{2}) * v);
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> gradient(const LatticePack<Lanes>& hash, const simd::Pack<T, Lanes>& x, const simd::Pack<T, Lanes>& y, const simd::Pack<T, Lanes>& z) noexcept
+        {
+            using Pack = simd::Pack<T, Lanes>;
+            const auto h = hash_field<T>(hash, 15U);
+            const auto u = select(h < Pack::broadcast(T{8}), x, y);
+            const auto v = select(h < Pack::broadcast(T{4}), y, select((h == Pack::broadcast(T{12})) | (h == Pack::broadcast(T{14})), x, z));
+            return select(hash_bit<T>(hash, 1U), -u, u) + select(hash_bit<T>(hash, 2U), -v, v);
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> gradient(const LatticePack<Lanes>& hash,
+                                                           const simd::Pack<T, Lanes>& x,
+                                                           const simd::Pack<T, Lanes>& y,
+                                                           const simd::Pack<T, Lanes>& z,
+                                                           const simd::Pack<T, Lanes>& w) noexcept
+        {
+            using Pack = simd::Pack<T, Lanes>;
+            const auto h = hash_field<T>(hash, 31U);
+            const auto u = select(h < Pack::broadcast(T{24}), x, y);
+            const auto v = select(h < Pack::broadcast(T{16}), y, z);
+            const auto s = select(h < Pack::broadcast(T{8}), z, w);
+            return select(hash_bit<T>(hash, 1U), -u, u) + select(hash_bit<T>(hash, 2U), -v, v) + select(hash_bit<T>(hash, 4U), -s, s);
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> fade(const simd::Pack<T, Lanes>& t) noexcept
+        {
+            using Pack = simd::Pack<T, Lanes>;
+            return t * t * t * (t * (t * Pack::broadcast(T{6}) - Pack::broadcast(T{15})) + Pack::broadcast(T{10}));
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> mix(const simd::Pack<T, Lanes>& from, const simd::Pack<T, Lanes>& to, const simd::Pack<T, Lanes>& t) noexcept
+        {
+            return from + (to - from) * t;
+        }
+
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> corner_weight(T radius_squared, const simd::Pack<T, Lanes>& distance_squared) noexcept
+        {
+            using Pack = simd::Pack<T, Lanes>;
+            auto t = Pack::broadcast(radius_squared) - distance_squared;
+            t = select(t < Pack::broadcast(T{0}), Pack::broadcast(T{0}), t);
+            t = t * t;
+            return t * t;
+        }
+
+        // 1 where mask is set, 0 elsewhere
+        template<typename T, std::size_t Lanes>
+        [[nodiscard]] inline simd::Pack<T, Lanes> step(const simd::Mask<T, Lanes>& mask) noexcept
+        {
+            return select(mask, simd::Pack<T, Lanes>::broadcast(T{1}), simd::Pack<T, Lanes>::broadcast(T{0}));
+        }
+    } // namespace detail
+
+    // Lanes versions of the sample functions. Every lane runs the arithmetic of
+    // the scalar overload with select in place of branches. Compilers may
+    // contract different multiply-adds here than in the scalar code, so lanes
+    // can differ from the scalar result in the last bits; the batch functions
+    // below only use these overloads so their results do not depend on chunking.
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> perlin(const WideVector<T, 2, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        const auto one = Pack::broadcast(T{1});
+        const auto floor_x = detail::floor(point[0]);
+        const auto floor_y = detail::floor(point[1]);
+        const auto ix = detail::lattice(floor_x);
+        const auto iy = detail::lattice(floor_y);
+        const auto ix1 = detail::lattice(floor_x + one);
+        const auto iy1 = detail::lattice(floor_y + one);
+        const auto fx = point[0] - floor_x;
+        const auto fy = point[1] - floor_y;
+
+        const auto n00 = detail::gradient(detail::hash_lattice(seed, ix, iy), fx, fy);
+        const auto n10 = detail::gradient(detail::hash_lattice(seed, ix1, iy), fx - one, fy);
+        const auto n01 = detail::gradient(detail::hash_lattice(seed, ix, iy1), fx, fy - one);
+        const auto n11 = detail::gradient(detail::hash_lattice(seed, ix1, iy1), fx - one, fy - one);
+
+        const auto u = detail::fade(fx);
+        const auto v = detail::fade(fy);
+        return Pack::broadcast(static_cast<T>(.507)) * detail::mix(detail::mix(n00, n10, u), detail::mix(n01, n11, u), v);
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> perlin(const WideVector<T, 3, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        // Lattice coordinates and offsets from the near (0) and far (1) corner on each axis
+        std::array<detail::LatticePack<Lanes>, 3> cell[2];
+        std::array<Pack, 3> offset[2];
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            const auto floored = detail::floor(point[axis]);
+            cell[0][axis] = detail::lattice(floored);
+            cell[1][axis] = detail::lattice(floored + Pack::broadcast(T{1}));
+            offset[0][axis] = point[axis] - floored;
+            offset[1][axis] = offset[0][axis] - Pack::broadcast(T{1});
+        }
+
+        auto corner = [&](std::size_t dx, std::size_t dy, std::size_t dz) {
+            return detail::gradient(detail::hash_lattice(seed, cell[dx][0], cell[dy][1], cell[dz][2]), offset[dx][0], offset[dy][1], offset[dz][2]);
+        };
+
+        const auto u = detail::fade(offset[0][0]);
+        const auto v = detail::fade(offset[0][1]);
+        const auto w = detail::fade(offset[0][2]);
+        const auto near = detail::mix(detail::mix(corner(0, 0, 0), corner(1, 0, 0), u), detail::mix(corner(0, 1, 0), corner(1, 1, 0), u), v);
+        const auto far = detail::mix(detail::mix(corner(0, 0, 1), corner(1, 0, 1), u), detail::mix(corner(0, 1, 1), corner(1, 1, 1), u), v);
+        return Pack::broadcast(static_cast<T>(.936)) * detail::mix(near, far, w);
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> perlin(const WideVector<T, 4, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        std::array<detail::LatticePack<Lanes>, 4> cell[2];
+        std::array<Pack, 4> offset[2];
+        std::array<Pack, 4> fades;
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            const auto floored = detail::floor(point[axis]);
+            cell[0][axis] = detail::lattice(floored);
+            cell[1][axis] = detail::lattice(floored + Pack::broadcast(T{1}));
+            offset[0][axis] = point[axis] - floored;
+            offset[1][axis] = offset[0][axis] - Pack::broadcast(T{1});
+            fades[axis] = detail::fade(offset[0][axis]);
+        }
+
+        std::array<Pack, 16> values;
+        for (std::size_t c = 0; c < 16; ++c) {
+            const auto dx = c & 1;
+            const auto dy = (c >> 1) & 1;
+            const auto dz = (c >> 2) & 1;
+            const auto dw = (c >> 3) & 1;
+            values[c] = detail::gradient(detail::hash_lattice(seed, cell[dx][0], cell[dy][1], cell[dz][2], cell[dw][3]),
+                                         offset[dx][0], offset[dy][1], offset[dz][2], offset[dw][3]);
+        }
+        for (std::size_t axis = 0, count = 16; axis < 4; ++axis, count /= 2) {
+            for (std::size_t c = 0; c < count / 2; ++c) {
+                values[c] = detail::mix(values[c * 2], values[c * 2 + 1], fades[axis]);
+            }
+        }
+        return Pack::broadcast(static_cast<T>(.87)) * values[0];
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> simplex(const WideVector<T, 2, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        constexpr auto skew = static_cast<T>(.366025403784438647);   // (sqrt(3) - 1) / 2
+        constexpr auto unskew = static_cast<T>(.211324865405187118); // (3 - sqrt(3)) / 6
+        const auto one = Pack::broadcast(T{1});
+
+        const auto s = (point[0] + point[1]) * Pack::broadcast(skew);
+        const auto i = detail::floor(point[0] + s);
+        const auto j = detail::floor(point[1] + s);
+        const auto t = (i + j) * Pack::broadcast(unskew);
+        const auto x0 = point[0] - (i - t);
+        const auto y0 = point[1] - (j - t);
+
+        const auto i1 = detail::step(x0 > y0);
+        const auto j1 = one - i1;
+        const auto x1 = x0 - i1 + Pack::broadcast(unskew);
+        const auto y1 = y0 - j1 + Pack::broadcast(unskew);
+        const auto x2 = x0 - one + Pack::broadcast(T{2} * unskew);
+        const auto y2 = y0 - one + Pack::broadcast(T{2} * unskew);
+
+        const auto n0 = detail::corner_weight(T{.5}, x0 * x0 + y0 * y0) * detail::gradient(detail::hash_lattice(seed, detail::lattice(i), detail::lattice(j)), x0, y0);
+        const auto n1 = detail::corner_weight(T{.5}, x1 * x1 + y1 * y1) * detail::gradient(detail::hash_lattice(seed, detail::lattice(i + i1), detail::lattice(j + j1)), x1, y1);
+        const auto n2 = detail::corner_weight(T{.5}, x2 * x2 + y2 * y2) * detail::gradient(detail::hash_lattice(seed, detail::lattice(i + one), detail::lattice(j + one)), x2, y2);
+        return Pack::broadcast(T{40}) * (n0 + n1 + n2);
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> simplex(const WideVector<T, 3, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        constexpr auto skew = T{1} / T{3};
+        constexpr auto unskew = T{1} / T{6};
+
+        const auto s = (point[0] + point[1] + point[2]) * Pack::broadcast(skew);
+        const auto i = detail::floor(point[0] + s);
+        const auto j = detail::floor(point[1] + s);
+        const auto k = detail::floor(point[2] + s);
+        const auto t = (i + j + k) * Pack::broadcast(unskew);
+        const auto x0 = point[0] - (i - t);
+        const auto y0 = point[1] - (j - t);
+        const auto z0 = point[2] - (k - t);
+
+        const auto rank_x = detail::step(x0 > y0) + detail::step(x0 > z0);
+        const auto rank_y = detail::step(y0 >= x0) + detail::step(y0 > z0);
+        const auto rank_z = detail::step(z0 >= x0) + detail::step(z0 >= y0);
+
+        auto contribution = [&](const Pack& di, const Pack& dj, const Pack& dk, T corner) {
+            const auto x = x0 - di + Pack::broadcast(corner * unskew);
+            const auto y = y0 - dj + Pack::broadcast(corner * unskew);
+            const auto z = z0 - dk + Pack::broadcast(corner * unskew);
+            const auto hash = detail::hash_lattice(seed, detail::lattice(i + di), detail::lattice(j + dj), detail::lattice(k + dk));
+            return detail::corner_weight(T{.6}, x * x + y * y + z * z) * detail::gradient(hash, x, y, z);
+        };
+
+        const auto zero = Pack::broadcast(T{0});
+        const auto one = Pack::broadcast(T{1});
+        const auto two = Pack::broadcast(T{2});
+        return Pack::broadcast(T{32}) * (contribution(zero, zero, zero, T{0}) +
+                                         contribution(detail::step(rank_x >= two), detail::step(rank_y >= two), detail::step(rank_z >= two), T{1}) +
+                                         contribution(detail::step(rank_x >= one), detail::step(rank_y >= one), detail::step(rank_z >= one), T{2}) +
+                                         contribution(one, one, one, T{3}));
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> simplex(const WideVector<T, 4, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        constexpr auto skew = static_cast<T>(.309016994374947451);   // (sqrt(5) - 1) / 4
+        constexpr auto unskew = static_cast<T>(.138196601125010504); // (5 - sqrt(5)) / 20
+
+        const auto s = (point[0] + point[1] + point[2] + point[3]) * Pack::broadcast(skew);
+        std::array<Pack, 4> cell;
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            cell[axis] = detail::floor(point[axis] + s);
+        }
+        const auto t = (cell[0] + cell[1] + cell[2] + cell[3]) * Pack::broadcast(unskew);
+        std::array<Pack, 4> offset;
+        for (std::size_t axis = 0; axis < 4; ++axis) {
+            offset[axis] = point[axis] - (cell[axis] - t);
+        }
+
+        std::array<Pack, 4> rank;
+        rank.fill(Pack::broadcast(T{0}));
+        for (std::size_t a = 0; a < 4; ++a) {
+            for (std::size_t b = a + 1; b < 4; ++b) {
+                const auto a_first = detail::step(offset[a] > offset[b]);
+                rank[a] = rank[a] + a_first;
+                rank[b] = rank[b] + (Pack::broadcast(T{1}) - a_first);
+            }
+        }
+
+        auto result = Pack::broadcast(T{0});
+        for (std::int32_t corner = 0; corner < 5; ++corner) {
+            std::array<Pack, 4> position;
+            std::array<detail::LatticePack<Lanes>, 4> lattice;
+            auto distance_squared = Pack::broadcast(T{0});
+            for (std::size_t axis = 0; axis < 4; ++axis) {
+                const auto step = detail::step(rank[axis] >= Pack::broadcast(static_cast<T>(4 - corner)));
+                position[axis] = offset[axis] - step + Pack::broadcast(static_cast<T>(corner) * unskew);
+                lattice[axis] = detail::lattice(cell[axis] + step);
+                distance_squared = distance_squared + position[axis] * position[axis];
+            }
+            result = result + detail::corner_weight(T{.6}, distance_squared) *
+                                  detail::gradient(detail::hash_lattice(seed, lattice[0], lattice[1], lattice[2], lattice[3]),
+                                                   position[0], position[1], position[2], position[3]);
+        }
+        return Pack::broadcast(T{27}) * result;
+    }
+
+    template<NoiseType Type, typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> noise(const WideVector<T, N, Lanes>& point, std::uint32_t seed = 0) noexcept
+    {
+        if constexpr (Type == NoiseType::perlin) {
+            return perlin(point, seed);
+        } else {
+            return simplex(point, seed);
+        }
+    }
+
+    template<NoiseType Type, typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> fbm(const WideVector<T, N, Lanes>& point, const FbmSettings<T>& settings = {}, std::uint32_t seed = 0) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        auto sum = Pack::broadcast(T{0});
+        T amplitude{1};
+        T total_amplitude{0};
+        T frequency{1};
+        for (std::size_t octave = 0; octave < settings.octaves; ++octave) {
+            sum = sum + Pack::broadcast(amplitude) * noise<Type>(point * frequency, seed + static_cast<std::uint32_t>(octave));
+            total_amplitude += amplitude;
+            amplitude *= settings.gain;
+            frequency *= settings.lacunarity;
+        }
+        return total_amplitude > T{0} ? sum / Pack::broadcast(total_amplitude) : Pack::broadcast(T{0});
+    }
+
+    namespace detail
+    {
+        // Widest pack whose samples and lattice hashes both fit native registers
+        template<typename T>
+        [[nodiscard]] consteval std::size_t noise_lanes() noexcept
+        {
+#if defined(ORION_MATH_AVX2)
+            if (std::is_same_v<T, float>) {
+                return 8;
+            }
+#endif
+#if defined(ORION_MATH_SSE2)
+            if (std::is_same_v<T, float>) {
+                return 4;
+            }
+#endif
+#if defined(ORION_MATH_AVX2)
+            if (std::is_same_v<T, double>) {
+                return 4;
+            }
+#endif
+            return 1;
+        }
+    } // namespace detail
+
+    // Samples per iteration of the batch loops: 8 floats or 4 doubles under
+    // AVX2, 4 floats with SSE2, otherwise 1. Plain AVX leaves doubles scalar,
+    // compilers split its double blends on compare masks into per-lane branches.
+    template<typename T>
+    inline constexpr std::size_t noise_batch_lanes = detail::noise_lanes<T>();
+
+    namespace detail
+    {
+        // result[i] = sample(point(i)). Points go through the lane versions of
+        // the sample functions, the remainder of each chunk padded with its last
+        // point, so every sample takes the same path wherever the chunks end.
+        template<typename T, std::size_t N, typename Point, typename Sample>
+        void fill_noise(std::span<T> result, unsigned thread_count, Point point, Sample sample)
+        {
+            constexpr auto lanes = noise_batch_lanes<T>;
+            ORION_MATH_INSTRUMENT_BATCH(result.size());
+            parallel_for(result.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                if constexpr (lanes > 1) {
+                    for (auto i = begin; i < end; i += lanes) {
+                        const auto count = end - i < lanes ? end - i : lanes;
+                        std::array<Vector<T, N>, lanes> points;
+                        for (std::size_t lane = 0; lane < lanes; ++lane) {
+                            points[lane] = point(i + (lane < count ? lane : count - 1));
+                        }
+                        const auto samples = sample(WideVector<T, N, lanes>::load(points));
+                        if (count == lanes) {
+                            samples.store(result.data() + i);
+                        } else {
+                            std::array<T, lanes> padded;
+                            samples.store(padded.data());
+                            std::copy_n(padded.begin(), count, result.begin() + static_cast<std::ptrdiff_t>(i));
+                        }
+                    }
+                } else {
+                    for (auto i = begin; i < end; ++i) {
+                        result[i] = sample(point(i));
+                    }
+                }
+            });
+        }
+
+        // Plain noise when settings has no octaves, fBm otherwise, decided once for the whole batch
+        template<NoiseType Type, typename T, std::size_t N, typename Point>
+        void fill_noise_or_fbm(std::span<T> result, const FbmSettings<T>& settings, std::uint32_t seed, unsigned thread_count, Point point)
+        {
+            if (settings.octaves == 0) {
+                fill_noise<T, N>(result, thread_count, point, [seed](const auto& sample_point) { return noise<Type>(sample_point, seed); });
+            } else {
+                fill_noise<T, N>(result, thread_count, point, [&settings, seed](const auto& sample_point) { return fbm<Type>(sample_point, settings, seed); });
+            }
+        }
+
+        template<NoiseType Type, typename T, std::size_t N>
+        void noise_points(std::span<const Vector<T, N>> points, std::span<T> result, std::uint32_t seed, unsigned thread_count)
+        {
+            if (points.size() != result.size()) {
+                throw std::invalid_argument("batch spans must have the same size");
+            }
+            fill_noise<T, N>(result, thread_count, [points](std::size_t i) { return points[i]; }, [seed](const auto& point) { return noise<Type>(point, seed); });
+        }
+
+        template<NoiseType Type, typename T, std::size_t N>
+        void fbm_points(std::span<const Vector<T, N>> points, std::span<T> result, const FbmSettings<T>& settings, std::uint32_t seed, unsigned thread_count)
+        {
+            if (points.size() != result.size()) {
+                throw std::invalid_argument("batch spans must have the same size");
+            }
+            fill_noise<T, N>(result, thread_count, [points](std::size_t i) { return points[i]; }, [&settings, seed](const auto& point) { return fbm<Type>(point, settings, seed); });
+        }
+    } // namespace detail
+
+    // result[i] = noise<Type>(points[i], seed)
+    template<NoiseType Type, typename T = float>
+    void noise(std::type_identity_t<std::span<const Vector2_t<T>>> points, std::type_identity_t<std::span<T>> result, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::noise_points<Type>(points, result, seed, thread_count);
+    }
+
+    template<NoiseType Type, typename T = float>
+    void noise(std::type_identity_t<std::span<const Vector3_t<T>>> points, std::type_identity_t<std::span<T>> result, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::noise_points<Type>(points, result, seed, thread_count);
+    }
+
+    template<NoiseType Type, typename T = float>
+    void noise(std::type_identity_t<std::span<const Vector4_t<T>>> points, std::type_identity_t<std::span<T>> result, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::noise_points<Type>(points, result, seed, thread_count);
+    }
+
+    // result[i] = fbm<Type>(points[i], settings, seed)
+    template<NoiseType Type, typename T = float>
+    void fbm(std::type_identity_t<std::span<const Vector2_t<T>>> points, std::type_identity_t<std::span<T>> result, const std::type_identity_t<FbmSettings<T>>& settings = {}, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::fbm_points<Type>(points, result, settings, seed, thread_count);
+    }
+
+    template<NoiseType Type, typename T = float>
+    void fbm(std::type_identity_t<std::span<const Vector3_t<T>>> points, std::type_identity_t<std::span<T>> result, const std::type_identity_t<FbmSettings<T>>& settings = {}, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::fbm_points<Type>(points, result, settings, seed, thread_count);
+    }
+
+    template<NoiseType Type, typename T = float>
+    void fbm(std::type_identity_t<std::span<const Vector4_t<T>>> points, std::type_identity_t<std::span<T>> result, const std::type_identity_t<FbmSettings<T>>& settings = {}, std::uint32_t seed = 0, unsigned thread_count = 1)
+    {
+        detail::fbm_points<Type>(points, result, settings, seed, thread_count);
+    }
+
+    // Fills a row major width x height grid sampled at origin + (x, y) * spacing.
+    // An octave count of 0 in settings samples plain noise instead of fBm.
+    template<NoiseType Type, typename T = float>
+    void noise_grid(const std::type_identity_t<Vector2_t<T>>& origin,
+                    const std::type_identity_t<Vector2_t<T>>& spacing,
+                    std::size_t width,
+                    std::size_t height,
+                    std::type_identity_t<std::span<T>> result,
+                    const std::type_identity_t<FbmSettings<T>>& settings = {0},
+                    std::uint32_t seed = 0,
+                    unsigned thread_count = 1)
+    {
+        if (result.size() != width * height) {
+            throw std::invalid_argument("grid span must hold width * height samples");
+        }
+        detail::fill_noise_or_fbm<Type, T, 2>(result, settings, seed, thread_count, [&](std::size_t i) {
+            return Vector2_t<T>{origin[0] + static_cast<T>(i % width) * spacing[0], origin[1] + static_cast<T>(i / width) * spacing[1]};
+        });
+    }
+
+    // Fills a width x height x depth grid with x varying fastest, then y, then z
+    template<NoiseType Type, typename T = float>
+    void noise_grid(const std::type_identity_t<Vector3_t<T>>& origin,
+                    const std::type_identity_t<Vector3_t<T>>& spacing,
+                    std::size_t width,
+                    std::size_t height,
+                    std::size_t depth,
+                    std::type_identity_t<std::span<T>> result,
+                    const std::type_identity_t<FbmSettings<T>>& settings = {0},
+                    std::uint32_t seed = 0,
+                    unsigned thread_count = 1)
+    {
+        if (result.size() != width * height * depth) {
+            throw std::invalid_argument("grid span must hold width * height * depth samples");
+        }
+        detail::fill_noise_or_fbm<Type, T, 3>(result, settings, seed, thread_count, [&](std::size_t i) {
+            const auto x = i % width;
+            const auto y = (i / width) % height;
+            const auto z = i / (width * height);
+            return Vector3_t<T>{origin[0] + static_cast<T>(x) * spacing[0], origin[1] + static_cast<T>(y) * spacing[1], origin[2] + static_cast<T>(z) * spacing[2]};
+        });
+    }
+} // namespace orion::math
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm> // std::max, std::min
+#include <cstddef>   // std::size_t
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <thread>    // std::jthread, std::thread::hardware_concurrency
+#include <vector>    // std::vector
+
+namespace orion::math
+{
+    // Smallest amount of work items worth handing to a separate thread
+    inline constexpr std::size_t parallel_min_chunk_size = 1024;
+
+    // A thread count of 0 selects the number of hardware threads
+    [[nodiscard]] inline unsigned resolve_thread_count(unsigned thread_count) noexcept
+    {
+        if (thread_count != 0) {
+            return thread_count;
+        }
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    // Number of chunks parallel_for will split count items into. Callers that
+    // keep per-chunk state (accumulation buckets, partial results) size it with this.
+    [[nodiscard]] inline std::size_t parallel_chunk_count(std::size_t count, unsigned thread_count, std::size_t min_chunk_size = parallel_min_chunk_size) noexcept
+    {
+        const auto max_chunks = std::max<std::size_t>(1, count / std::max<std::size_t>(1, min_chunk_size));
+        return std::min<std::size_t>(resolve_thread_count(thread_count), max_chunks);
+    }
+
+    // Splits [0, count) into contiguous chunks and calls function(begin, end, chunk)
+    // for each of them. The first chunk runs on the calling thread, exceptions
+    // thrown by any chunk are rethrown once all of them have finished.
+    template<typename Function>
+    void parallel_for(std::size_t count, unsigned thread_count, Function&& function, std::size_t min_chunk_size = parallel_min_chunk_size)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        const auto chunks = parallel_chunk_count(count, thread_count, min_chunk_size);
+        if (chunks == 1) {
+            function(std::size_t{0}, count, std::size_t{0});
+            return;
+        }
+
+        auto chunk_begin = [count, chunks](std::size_t chunk) { return count * chunk / chunks; };
+        std::vector<std::exception_ptr> errors(chunks);
+        auto run_chunk = [&](std::size_t chunk) {
+            try {
+                function(chunk_begin(chunk), chunk_begin(chunk + 1), chunk);
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks - 1);
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                workers.emplace_back(run_chunk, chunk);
+            }
+            run_chunk(0);
+        }
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+} // namespace orion::math
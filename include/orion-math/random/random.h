@@ -0,0 +1,343 @@
+#pragma once
+
+#include "orion-math/constants.h"  // pi_v
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for
+#include "orion-math/simd.h"       // simd::Pack
+#include "orion-math/vector/vector2.h"
+#include "orion-math/vector/vector3.h"
+#include "orion-math/vector/vector4.h"
+
+#include <algorithm>   // std::max, std::min
+#include <array>       // std::array
+#include <concepts>    // std::floating_point
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint32_t, std::uint64_t
+#include <span>        // std::span
+#include <type_traits> // std::type_identity_t
+
+namespace orion::math
+{
+    namespace detail
+    {
+        [[nodiscard]] constexpr std::uint64_t splitmix64(std::uint64_t& state) noexcept
+        {
+            auto z = (state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        [[nodiscard]] constexpr std::uint32_t rotl(std::uint32_t value, int shift) noexcept
+        {
+            return (value << shift) | (value >> (32 - shift));
+        }
+    } // namespace detail
+
+    // Eight interleaved xoshiro128+ generators. The state is stored lane by lane
+    // so one step is a handful of 8-wide integer operations, and every call to
+    // next() yields one 32-bit value per lane.
+    //
+    // Generators built from the same seed and stream produce the same sequence on
+    // every platform. Different streams are seeded through splitmix64 and are
+    // meant to be handed to different threads or work blocks.
+    class Xoshiro128x8
+    {
+    public:
+        static constexpr std::size_t lanes = 8;
+
+        template<typename T>
+        using Lanes = std::array<T, lanes>;
+
+        explicit constexpr Xoshiro128x8(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+        {
+            // The stream is folded into the mixed seed rather than mixed the same
+            // way, so swapping seed and stream, or picking them equal, still
+            // gives distinct generators
+            auto seed_state = seed;
+            std::uint64_t mix = detail::splitmix64(seed_state) ^ (stream * 0xd1342543de82ef95ULL);
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                for (std::size_t word = 0; word < 4; word += 2) {
+                    const auto bits = detail::splitmix64(mix);
+                    state_[word][lane] = static_cast<std::uint32_t>(bits);
+                    state_[word + 1][lane] = static_cast<std::uint32_t>(bits >> 32);
+                }
+                // An all zero state would only ever produce zeros
+                if ((state_[0][lane] | state_[1][lane] | state_[2][lane] | state_[3][lane]) == 0) {
+                    state_[0][lane] = 1;
+                }
+            }
+        }
+
+        // The auto-vectorizer loses track of the lanes once the state is
+        // scalarized inside a caller's loop, so x86 steps four lanes at a time
+        // with SSE2 and the loop below is left for other targets.
+        [[nodiscard]] Lanes<std::uint32_t> next() noexcept
+        {
+            Lanes<std::uint32_t> result;
+#if defined(ORION_MATH_SSE2)
+            for (std::size_t lane = 0; lane < lanes; lane += 4) {
+                auto load = [lane](const Lanes<std::uint32_t>& word) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(word.data() + lane)); };
+                auto store = [lane](Lanes<std::uint32_t>& word, __m128i value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(word.data() + lane), value); };
+                const auto s0 = load(state_[0]);
+                const auto s1 = load(state_[1]);
+                const auto t2 = _mm_xor_si128(load(state_[2]), s0);
+                const auto t3 = _mm_xor_si128(load(state_[3]), s1);
+                store(result, _mm_add_epi32(s0, load(state_[3])));
+                store(state_[0], _mm_xor_si128(s0, t3));
+                store(state_[1], _mm_xor_si128(s1, t2));
+                store(state_[2], _mm_xor_si128(t2, _mm_slli_epi32(s1, 9)));
+                store(state_[3], _mm_or_si128(_mm_slli_epi32(t3, 11), _mm_srli_epi32(t3, 21)));
+            }
+#else
+            auto& [s0, s1, s2, s3] = state_;
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                result[lane] = s0[lane] + s3[lane];
+                const auto shifted = s1[lane] << 9;
+                const auto t2 = s2[lane] ^ s0[lane];
+                const auto t3 = s3[lane] ^ s1[lane];
+                s1[lane] ^= t2;
+                s0[lane] ^= t3;
+                s2[lane] = t2 ^ shifted;
+                s3[lane] = detail::rotl(t3, 11);
+            }
+#endif
+            return result;
+        }
+
+        // Uniform values in [0, 1). Floats use the top 24 bits of each lane, doubles
+        // all 32, which is plenty for sampling but not a full 53-bit mantissa.
+        template<std::floating_point T = float>
+        [[nodiscard]] Lanes<T> uniform() noexcept
+        {
+            const auto bits = next();
+            Lanes<T> result;
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                if constexpr (sizeof(T) == sizeof(float)) {
+                    result[lane] = static_cast<T>(static_cast<std::int32_t>(bits[lane] >> 8)) * T{0x1.0p-24};
+                } else {
+                    result[lane] = static_cast<T>(bits[lane]) * T{0x1.0p-32};
+                }
+            }
+            return result;
+        }
+
+    private:
+        std::array<Lanes<std::uint32_t>, 4> state_{};
+    };
+
+    // Output elements per work block of parallel_random
+    inline constexpr std::size_t random_block_size = 4096;
+
+    // Splits [0, count) into blocks of random_block_size and calls
+    // function(generator, begin, end) with a generator seeded from seed and the
+    // block index. The result is the same for every thread count.
+    template<typename Function>
+    void parallel_random(std::uint64_t seed, std::size_t count, unsigned thread_count, Function&& function)
+    {
+        const auto blocks = (count + random_block_size - 1) / random_block_size;
+        parallel_for(
+            blocks, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (auto block = begin; block < end; ++block) {
+                    Xoshiro128x8 generator{seed, block};
+                    function(generator, block * random_block_size, std::min(count, (block + 1) * random_block_size));
+                }
+            },
+            1);
+    }
+
+    namespace detail
+    {
+        // sin and cos of a full turn scaled by turn in [0, 1). The angle is folded
+        // into [-pi/2, pi/2] where short Taylor polynomials are accurate to
+        // about 1e-8, keeping the lane loops free of library calls.
+        template<typename T>
+        constexpr void sin_cos_turn(T turn, T& sin, T& cos) noexcept
+        {
+            const auto angle = (turn - T{.5}) * T{2} * pi_v<T>;
+            const auto half_pi = pi_v<T> / T{2};
+            const auto negative = angle < T{0};
+            const auto folded = (negative ? -angle : angle) > half_pi;
+            const auto x = folded ? (negative ? -pi_v<T> : pi_v<T>) - angle : angle;
+            const auto x2 = x * x;
+            sin = x * (T{1} + x2 * (T{-1} / 6 + x2 * (T{1} / 120 + x2 * (T{-1} / 5'040 + x2 * (T{1} / 362'880 + x2 * (T{-1} / 39'916'800 + x2 * (T{1} / 6'227'020'800)))))));
+            const auto c = T{1} + x2 * (T{-1} / 2 + x2 * (T{1} / 24 + x2 * (T{-1} / 720 + x2 * (T{1} / 40'320 + x2 * (T{-1} / 3'628'800 + x2 * (T{1} / 479'001'600 + x2 * (T{-1} / 87'178'291'200)))))));
+            cos = folded ? -c : c;
+        }
+
+        template<typename T>
+        using RandomBlock = Xoshiro128x8::Lanes<T>;
+
+        // In place square root of every lane. Going through simd::Pack keeps the
+        // errno handling of std::sqrt out of the lane loops so they vectorize.
+        template<typename T>
+        void sqrt_lanes(RandomBlock<T>& values) noexcept
+        {
+            using Pack = simd::Pack<T, 4>;
+            for (std::size_t i = 0; i < values.size(); i += Pack::lanes) {
+                sqrt(Pack::load(values.data() + i)).store(values.data() + i);
+            }
+        }
+
+        // Fills out lanes elements at a time. generate(uniforms, block) turns
+        // Uniforms steps of uniform values into one element per lane, a partial
+        // last block discards the unused lanes.
+        template<std::size_t Uniforms, typename T, typename Out, typename Generate>
+        void fill_random(Xoshiro128x8& generator, std::span<Out> out, Generate generate)
+        {
+            ORION_MATH_INSTRUMENT_BATCH(out.size());
+            constexpr auto lanes = Xoshiro128x8::lanes;
+            // A local copy lets the state live in registers across the loop
+            auto local = generator;
+            for (std::size_t i = 0; i < out.size(); i += lanes) {
+                std::array<RandomBlock<T>, Uniforms> uniforms;
+                for (auto& step : uniforms) {
+                    step = local.uniform<T>();
+                }
+                RandomBlock<Out> block;
+                generate(uniforms, block);
+                const auto count = std::min(lanes, out.size() - i);
+                for (std::size_t lane = 0; lane < count; ++lane) {
+                    out[i + lane] = block[lane];
+                }
+            }
+            generator = local;
+        }
+
+        template<typename T, std::size_t N>
+        void uniform_box(Xoshiro128x8& generator, std::span<Vector<T, N>> out, const Vector<T, N>& min, const Vector<T, N>& max)
+        {
+            const auto extent = max - min;
+            fill_random<N, T>(generator, out, [&](const std::array<RandomBlock<T>, N>& u, RandomBlock<Vector<T, N>>& block) {
+                for (std::size_t lane = 0; lane < block.size(); ++lane) {
+                    for (std::size_t i = 0; i < N; ++i) {
+                        block[lane][i] = min[i] + u[i][lane] * extent[i];
+                    }
+                }
+            });
+        }
+
+        // Points in the unit disk with radius sqrt(radius_uniform)
+        template<typename T>
+        void disk_points(RandomBlock<T> radius, const RandomBlock<T>& turn, RandomBlock<T>& x, RandomBlock<T>& y) noexcept
+        {
+            sqrt_lanes(radius);
+            for (std::size_t lane = 0; lane < radius.size(); ++lane) {
+                T sin{};
+                T cos{};
+                sin_cos_turn(turn[lane], sin, cos);
+                x[lane] = radius[lane] * cos;
+                y[lane] = radius[lane] * sin;
+            }
+        }
+
+        // Archimedes: a uniform height and a uniform angle give a uniform direction
+        template<typename T>
+        void sphere_directions(const RandomBlock<T>& height, const RandomBlock<T>& turn, RandomBlock<Vector3_t<T>>& block) noexcept
+        {
+            RandomBlock<T> radius;
+            for (std::size_t lane = 0; lane < radius.size(); ++lane) {
+                const auto z = T{1} - T{2} * height[lane];
+                radius[lane] = std::max(T{0}, T{1} - z * z);
+            }
+            sqrt_lanes(radius);
+            for (std::size_t lane = 0; lane < radius.size(); ++lane) {
+                T sin{};
+                T cos{};
+                sin_cos_turn(turn[lane], sin, cos);
+                block[lane] = {radius[lane] * cos, radius[lane] * sin, T{1} - T{2} * height[lane]};
+            }
+        }
+    } // namespace detail
+
+    // Uniform points in the axis aligned box [min, max)
+    template<typename T = float>
+    void uniform_box(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector2_t<T>>> out, const std::type_identity_t<Vector2_t<T>>& min, const std::type_identity_t<Vector2_t<T>>& max)
+    {
+        detail::uniform_box(generator, out, min, max);
+    }
+
+    template<typename T = float>
+    void uniform_box(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector3_t<T>>> out, const std::type_identity_t<Vector3_t<T>>& min, const std::type_identity_t<Vector3_t<T>>& max)
+    {
+        detail::uniform_box(generator, out, min, max);
+    }
+
+    template<typename T = float>
+    void uniform_box(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector4_t<T>>> out, const std::type_identity_t<Vector4_t<T>>& min, const std::type_identity_t<Vector4_t<T>>& max)
+    {
+        detail::uniform_box(generator, out, min, max);
+    }
+
+    // Uniformly distributed directions on the unit circle
+    template<typename T = float>
+    void unit_directions(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector2_t<T>>> out)
+    {
+        detail::fill_random<1, T>(generator, out, [](const std::array<detail::RandomBlock<T>, 1>& u, detail::RandomBlock<Vector2_t<T>>& block) {
+            for (std::size_t lane = 0; lane < block.size(); ++lane) {
+                T sin{};
+                T cos{};
+                detail::sin_cos_turn(u[0][lane], sin, cos);
+                block[lane] = {cos, sin};
+            }
+        });
+    }
+
+    // Uniformly distributed directions on the unit sphere
+    template<typename T = float>
+    void unit_directions(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector3_t<T>>> out)
+    {
+        detail::fill_random<2, T>(generator, out, [](const std::array<detail::RandomBlock<T>, 2>& u, detail::RandomBlock<Vector3_t<T>>& block) {
+            detail::sphere_directions(u[0], u[1], block);
+        });
+    }
+
+    // Uniformly distributed points inside the unit disk
+    template<typename T = float>
+    void points_in_disk(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector2_t<T>>> out)
+    {
+        detail::fill_random<2, T>(generator, out, [](const std::array<detail::RandomBlock<T>, 2>& u, detail::RandomBlock<Vector2_t<T>>& block) {
+            detail::RandomBlock<T> x;
+            detail::RandomBlock<T> y;
+            detail::disk_points(u[0], u[1], x, y);
+            for (std::size_t lane = 0; lane < block.size(); ++lane) {
+                block[lane] = {x[lane], y[lane]};
+            }
+        });
+    }
+
+    // Uniformly distributed points inside the unit ball. The radius is the
+    // largest of three uniforms, whose distribution r^3 is exactly the one
+    // needed, which avoids a cube root per sample.
+    template<typename T = float>
+    void points_in_sphere(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector3_t<T>>> out)
+    {
+        detail::fill_random<5, T>(generator, out, [](const std::array<detail::RandomBlock<T>, 5>& u, detail::RandomBlock<Vector3_t<T>>& block) {
+            detail::sphere_directions(u[0], u[1], block);
+            for (std::size_t lane = 0; lane < block.size(); ++lane) {
+                block[lane] = block[lane] * std::max(u[2][lane], std::max(u[3][lane], u[4][lane]));
+            }
+        });
+    }
+
+    // Cosine weighted directions on the hemisphere around +z, built by lifting
+    // uniform disk points onto the hemisphere. Rotate them into the frame of
+    // the surface normal before use.
+    template<typename T = float>
+    void cosine_hemisphere(Xoshiro128x8& generator, std::type_identity_t<std::span<Vector3_t<T>>> out)
+    {
+        detail::fill_random<2, T>(generator, out, [](const std::array<detail::RandomBlock<T>, 2>& u, detail::RandomBlock<Vector3_t<T>>& block) {
+            detail::RandomBlock<T> x;
+            detail::RandomBlock<T> y;
+            detail::disk_points(u[0], u[1], x, y);
+            detail::RandomBlock<T> z;
+            for (std::size_t lane = 0; lane < z.size(); ++lane) {
+                z[lane] = std::max(T{0}, T{1} - x[lane] * x[lane] - y[lane] * y[lane]);
+            }
+            detail::sqrt_lanes(z);
+            for (std::size_t lane = 0; lane < block.size(); ++lane) {
+                block[lane] = {x[lane], y[lane], z[lane]};
+            }
+        });
+    }
+} // namespace orion::math
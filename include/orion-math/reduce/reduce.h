@@ -0,0 +1,342 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/matrix/matrix.h" // detail::static_for
+#include "orion-math/parallel.h" // parallel_chunk_count, parallel_for
+#include "orion-math/vector/vector.h"
+#include "orion-math/vector/wide.h" // WideVector
+
+#include <algorithm>   // std::max, std::min
+#include <array>       // std::array
+#include <cmath>       // std::sqrt
+#include <concepts>    // std::floating_point
+#include <cstddef>     // std::size_t
+#include <limits>      // std::numeric_limits
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    // Points summed straight in the innermost loop of a reduction. Larger ranges
+    // are split in halves, so rounding error grows with log(n / block) instead of n.
+    inline constexpr std::size_t reduce_block_size = 256;
+
+    // Independent accumulators per component, enough to fill an AVX register
+    inline constexpr std::size_t reduce_lanes = 8;
+
+    // Axis aligned box spanned by a set of points. Bounds of no points have min
+    // above max on every axis, so merging them with anything yields the other side.
+    template<typename T, std::size_t N>
+    struct Bounds {
+        Vector<T, N> min;
+        Vector<T, N> max;
+
+        [[nodiscard]] static constexpr Bounds empty() noexcept
+        {
+            Bounds result;
+            for (std::size_t i = 0; i < N; ++i) {
+                result.min[i] = std::numeric_limits<T>::max();
+                result.max[i] = std::numeric_limits<T>::lowest();
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (min[i] > max[i]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] constexpr friend Bounds merge(const Bounds& lhs, const Bounds& rhs) noexcept
+        {
+            Bounds result;
+            for (std::size_t i = 0; i < N; ++i) {
+                result.min[i] = std::min(lhs.min[i], rhs.min[i]);
+                result.max[i] = std::max(lhs.max[i], rhs.max[i]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr friend bool operator==(const Bounds& lhs, const Bounds& rhs) noexcept = default;
+    };
+
+    namespace detail
+    {
+        // Splits [begin, end) on block boundaries down to single blocks
+        template<typename Result, typename Leaf, typename Combine>
+        [[nodiscard]] Result pairwise_reduce(std::size_t begin, std::size_t end, const Leaf& leaf, const Combine& combine)
+        {
+            if (end - begin <= reduce_block_size) {
+                return leaf(begin, end);
+            }
+            const auto blocks = (end - begin + reduce_block_size - 1) / reduce_block_size;
+            const auto middle = begin + blocks / 2 * reduce_block_size;
+            return combine(pairwise_reduce<Result>(begin, middle, leaf, combine), pairwise_reduce<Result>(middle, end, leaf, combine));
+        }
+
+        // Combines neighbouring partials level by level rather than left to right
+        template<typename Result, typename Combine>
+        [[nodiscard]] Result tree_reduce(std::vector<Result> partials, const Combine& combine)
+        {
+            for (auto count = partials.size(); count > 1; count = (count + 1) / 2) {
+                for (std::size_t i = 0; i < count / 2; ++i) {
+                    partials[i] = combine(partials[2 * i], partials[2 * i + 1]);
+                }
+                if (count % 2 != 0) {
+                    partials[count / 2] = std::move(partials[count - 1]);
+                }
+            }
+            return std::move(partials.front());
+        }
+
+        // Each chunk reduces its range pairwise, the per-chunk partials are then
+        // combined as a tree. count must not be zero.
+        template<typename Result, typename Leaf, typename Combine>
+        [[nodiscard]] Result parallel_reduce(std::size_t count, unsigned thread_count, const Result& identity, const Leaf& leaf, const Combine& combine)
+        {
+            std::vector<Result> partials(parallel_chunk_count(count, thread_count), identity);
+            parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+                partials[chunk] = pairwise_reduce<Result>(begin, end, leaf, combine);
+            });
+            return tree_reduce(std::move(partials), combine);
+        }
+
+        // The leaves below keep reduce_lanes accumulators per component, point
+        // i + lane of every step going into accumulator lane * N + component.
+        // Points are read whole through operator[] from a span starting at the
+        // leaf, so each step still compiles to packed loads of its points. The
+        // loop over components goes through static_for, -O2 leaves it rolled
+        // otherwise.
+        template<typename T, std::size_t N>
+        [[nodiscard]] Vector<T, N> sum_leaf(std::span<const Vector<T, N>> points, std::size_t begin, std::size_t end) noexcept
+        {
+            const auto leaf = points.subspan(begin, end - begin);
+
+            std::array<T, N * reduce_lanes> accumulators{};
+            std::size_t i = 0;
+            for (; i + reduce_lanes <= leaf.size(); i += reduce_lanes) {
+                for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                    const auto& point = leaf[i + lane];
+                    static_for<0, N>([&](auto component) { accumulators[lane * N + component] += point[component]; });
+                }
+            }
+
+            Vector<T, N> result{};
+            for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                for (std::size_t component = 0; component < N; ++component) {
+                    result[component] += accumulators[lane * N + component];
+                }
+            }
+            for (; i < leaf.size(); ++i) {
+                for (std::size_t component = 0; component < N; ++component) {
+                    result[component] += leaf[i][component];
+                }
+            }
+            return result;
+        }
+
+        template<typename T, std::size_t N>
+        [[nodiscard]] Bounds<T, N> bounds_leaf(std::span<const Vector<T, N>> points, std::size_t begin, std::size_t end) noexcept
+        {
+            const auto leaf = points.subspan(begin, end - begin);
+
+            std::array<T, N * reduce_lanes> lower;
+            std::array<T, N * reduce_lanes> upper;
+            lower.fill(std::numeric_limits<T>::max());
+            upper.fill(std::numeric_limits<T>::lowest());
+            std::size_t i = 0;
+            for (; i + reduce_lanes <= leaf.size(); i += reduce_lanes) {
+                for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                    const auto& point = leaf[i + lane];
+                    static_for<0, N>([&](auto component) {
+                        const auto j = lane * N + component;
+                        lower[j] = point[component] < lower[j] ? point[component] : lower[j];
+                        upper[j] = point[component] > upper[j] ? point[component] : upper[j];
+                    });
+                }
+            }
+
+            auto result = Bounds<T, N>::empty();
+            for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                for (std::size_t component = 0; component < N; ++component) {
+                    result.min[component] = std::min(result.min[component], lower[lane * N + component]);
+                    result.max[component] = std::max(result.max[component], upper[lane * N + component]);
+                }
+            }
+            for (; i < leaf.size(); ++i) {
+                for (std::size_t component = 0; component < N; ++component) {
+                    result.min[component] = std::min(result.min[component], leaf[i][component]);
+                    result.max[component] = std::max(result.max[component], leaf[i][component]);
+                }
+            }
+            return result;
+        }
+
+        // Upper triangle of a symmetric N x N matrix, row by row
+        template<typename T, std::size_t N>
+        using UpperTriangle = std::array<T, N * (N + 1) / 2>;
+
+        // Sum of the outer products (p - center)(p - center)^T, reduce_lanes points at a time
+        template<typename T, std::size_t N>
+        [[nodiscard]] UpperTriangle<T, N> scatter_leaf(std::span<const Vector<T, N>> points, const Vector<T, N>& center, std::size_t begin, std::size_t end)
+        {
+            using Wide = WideVector<T, N, reduce_lanes>;
+            using Pack = typename Wide::value_type;
+
+            const auto wide_center = Wide::broadcast(center);
+            std::array<Pack, N * (N + 1) / 2> accumulators;
+            accumulators.fill(Pack::broadcast(T{0}));
+            std::size_t i = begin;
+            for (; i + reduce_lanes <= end; i += reduce_lanes) {
+                const auto offset = Wide::load(points.subspan(i, reduce_lanes)) - wide_center;
+                std::size_t k = 0;
+                for (std::size_t row = 0; row < N; ++row) {
+                    for (std::size_t column = row; column < N; ++column) {
+                        accumulators[k] = fmadd(offset[row], offset[column], accumulators[k]);
+                        ++k;
+                    }
+                }
+            }
+
+            UpperTriangle<T, N> result{};
+            for (std::size_t k = 0; k < result.size(); ++k) {
+                for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                    result[k] += accumulators[k][lane];
+                }
+            }
+            for (; i < end; ++i) {
+                const auto offset = points[i] - center;
+                std::size_t k = 0;
+                for (std::size_t row = 0; row < N; ++row) {
+                    for (std::size_t column = row; column < N; ++column) {
+                        result[k++] += offset[row] * offset[column];
+                    }
+                }
+            }
+            return result;
+        }
+
+        template<typename T, std::size_t N>
+        [[nodiscard]] T max_sqr_distance_leaf(std::span<const Vector<T, N>> points, const Vector<T, N>& center, std::size_t begin, std::size_t end)
+        {
+            using Wide = WideVector<T, N, reduce_lanes>;
+            using Pack = typename Wide::value_type;
+
+            const auto wide_center = Wide::broadcast(center);
+            auto farthest = Pack::broadcast(T{0});
+            std::size_t i = begin;
+            for (; i + reduce_lanes <= end; i += reduce_lanes) {
+                farthest = max(farthest, (Wide::load(points.subspan(i, reduce_lanes)) - wide_center).sqr_magnitude());
+            }
+
+            auto result = T{0};
+            for (std::size_t lane = 0; lane < reduce_lanes; ++lane) {
+                result = std::max(result, farthest[lane]);
+            }
+            for (; i < end; ++i) {
+                result = std::max(result, (points[i] - center).sqr_magnitude());
+            }
+            return result;
+        }
+
+        inline void check_not_empty(std::size_t count)
+        {
+            if (count == 0) {
+                throw std::invalid_argument("reduction needs at least one point");
+            }
+        }
+    } // namespace detail
+
+    // Component-wise sum, accumulated pairwise in blocks of reduce_block_size points.
+    // Float sums of millions of points stay within a few ulps of a double reference,
+    // where a running total would drift by the number of points times epsilon.
+    template<typename T = float, std::size_t N = 3>
+    [[nodiscard]] Vector<T, N> sum(std::type_identity_t<std::span<const Vector<T, N>>> points, unsigned thread_count = 1)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(points.size());
+        if (points.empty()) {
+            return {};
+        }
+        return detail::parallel_reduce(
+            points.size(), thread_count, Vector<T, N>{},
+            [points](std::size_t begin, std::size_t end) { return detail::sum_leaf(points, begin, end); },
+            [](const Vector<T, N>& lhs, const Vector<T, N>& rhs) { return lhs + rhs; });
+    }
+
+    // Centroid of the points. Throws std::invalid_argument when points is empty.
+    template<std::floating_point T = float, std::size_t N = 3>
+    [[nodiscard]] Vector<T, N> mean(std::type_identity_t<std::span<const Vector<T, N>>> points, unsigned thread_count = 1)
+    {
+        detail::check_not_empty(points.size());
+        return sum<T, N>(points, thread_count) / static_cast<T>(points.size());
+    }
+
+    // Component-wise min and max, Bounds::empty() when points is empty
+    template<typename T = float, std::size_t N = 3>
+    [[nodiscard]] Bounds<T, N> bounds(std::type_identity_t<std::span<const Vector<T, N>>> points, unsigned thread_count = 1)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(points.size());
+        if (points.empty()) {
+            return Bounds<T, N>::empty();
+        }
+        return detail::parallel_reduce(
+            points.size(), thread_count, Bounds<T, N>::empty(),
+            [points](std::size_t begin, std::size_t end) { return detail::bounds_leaf(points, begin, end); },
+            [](const Bounds<T, N>& lhs, const Bounds<T, N>& rhs) { return merge(lhs, rhs); });
+    }
+
+    // Population covariance, the mean outer product of the offsets from the
+    // centroid. Two passes: the centroid first, then the offsets, which avoids the
+    // cancellation of E[pp^T] - E[p]E[p]^T on scans far from the origin.
+    // Throws std::invalid_argument when points is empty.
+    template<std::floating_point T = float, std::size_t N = 3>
+    [[nodiscard]] Matrix<T, N, N> covariance(std::type_identity_t<std::span<const Vector<T, N>>> points, unsigned thread_count = 1)
+    {
+        const auto center = mean<T, N>(points, thread_count);
+        ORION_MATH_INSTRUMENT_BATCH(points.size());
+        const auto scatter = detail::parallel_reduce(
+            points.size(), thread_count, detail::UpperTriangle<T, N>{},
+            [points, &center](std::size_t begin, std::size_t end) { return detail::scatter_leaf(points, center, begin, end); },
+            [](const detail::UpperTriangle<T, N>& lhs, const detail::UpperTriangle<T, N>& rhs) {
+                detail::UpperTriangle<T, N> result;
+                for (std::size_t k = 0; k < result.size(); ++k) {
+                    result[k] = lhs[k] + rhs[k];
+                }
+                return result;
+            });
+
+        const auto count = static_cast<T>(points.size());
+        Matrix<T, N, N> result;
+        std::size_t k = 0;
+        for (std::size_t row = 0; row < N; ++row) {
+            for (std::size_t column = row; column < N; ++column) {
+                result[row][column] = scatter[k] / count;
+                result[column][row] = result[row][column];
+                ++k;
+            }
+        }
+        return result;
+    }
+
+    // Largest distance from center to any of the points, the radius of the
+    // smallest sphere around center holding all of them. 0 when points is empty.
+    template<std::floating_point T = float, std::size_t N = 3>
+    [[nodiscard]] T max_distance(std::type_identity_t<std::span<const Vector<T, N>>> points, const std::type_identity_t<Vector<T, N>>& center, unsigned thread_count = 1)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(points.size());
+        if (points.empty()) {
+            return T{0};
+        }
+        return std::sqrt(detail::parallel_reduce(
+            points.size(), thread_count, T{0},
+            [points, &center](std::size_t begin, std::size_t end) { return detail::max_sqr_distance_leaf(points, center, begin, end); },
+            [](T lhs, T rhs) { return std::max(lhs, rhs); }));
+    }
+} // namespace orion::math
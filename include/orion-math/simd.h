@@ -0,0 +1,690 @@
+#pragma once
+
+#include "target.h" // ORION_MATH_SSE2, ORION_MATH_SSE41, ORION_MATH_AVX, ORION_MATH_AVX2, ORION_MATH_FMA
+
+#include <array>       // std::array
+#include <cmath>       // std::sqrt
+#include <concepts>    // std::integral
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint32_t
+#include <functional>  // std::equal_to, std::not_equal_to, std::less, std::less_equal, std::greater, std::greater_equal
+#include <type_traits> // std::is_signed_v
+
+#if defined(ORION_MATH_SSE2)
+    #include <immintrin.h>
+#endif
+
+namespace orion::math::simd
+{
+    // Per-lane result of comparing two packs. The generic version keeps one
+    // bool per lane, specializations keep the all-ones or all-zeros lanes the
+    // native compare instructions produce, so select() needs no conversion.
+    template<typename T, std::size_t Lanes>
+    struct Mask {
+        using value_type = T;
+        static constexpr auto lanes = Lanes;
+
+        [[nodiscard]] static Mask broadcast(bool value) noexcept
+        {
+            Mask result;
+            result.values_.fill(value);
+            return result;
+        }
+
+        [[nodiscard]] bool operator[](std::size_t lane) const noexcept { return values_[lane]; }
+
+        // Lane i in bit i
+        [[nodiscard]] unsigned bits() const noexcept
+        {
+            unsigned result = 0;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result |= static_cast<unsigned>(values_[i]) << i;
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Mask operator&(const Mask& lhs, const Mask& rhs) noexcept { return combine(lhs, rhs, [](bool l, bool r) { return l && r; }); }
+        [[nodiscard]] friend Mask operator|(const Mask& lhs, const Mask& rhs) noexcept { return combine(lhs, rhs, [](bool l, bool r) { return l || r; }); }
+        [[nodiscard]] friend Mask operator^(const Mask& lhs, const Mask& rhs) noexcept { return combine(lhs, rhs, [](bool l, bool r) { return l != r; }); }
+        [[nodiscard]] friend Mask operator!(const Mask& mask) noexcept { return combine(mask, mask, [](bool l, bool) { return !l; }); }
+
+        std::array<bool, Lanes> values_; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    private:
+        template<typename Operation>
+        [[nodiscard]] static Mask combine(const Mask& lhs, const Mask& rhs, Operation operation) noexcept
+        {
+            Mask result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = operation(lhs.values_[i], rhs.values_[i]);
+            }
+            return result;
+        }
+    };
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] bool any(const Mask<T, Lanes>& mask) noexcept
+    {
+        return mask.bits() != 0;
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] bool all(const Mask<T, Lanes>& mask) noexcept
+    {
+        return mask.bits() == (1U << Lanes) - 1;
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] bool none(const Mask<T, Lanes>& mask) noexcept
+    {
+        return mask.bits() == 0;
+    }
+
+    // Fixed width pack of lanes. The generic version is a plain array whose
+    // lane-wise loops are left to the compiler to vectorize, specializations
+    // below map directly onto native registers where the target supports them.
+    template<typename T, std::size_t Lanes>
+    struct Pack {
+        using value_type = T;
+        static constexpr auto lanes = Lanes;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept
+        {
+            Pack result;
+            result.values_.fill(value);
+            return result;
+        }
+
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = ptr[i];
+            }
+            return result;
+        }
+
+        void store(value_type* ptr) const noexcept
+        {
+            for (std::size_t i = 0; i < lanes; ++i) {
+                ptr[i] = values_[i];
+            }
+        }
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept { return values_[lane]; }
+
+        [[nodiscard]] friend Pack operator+(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] + rhs.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack operator-(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] - rhs.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack operator*(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] * rhs.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack operator/(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] / rhs.values_[i];
+            }
+            return result;
+        }
+
+        // Computes lhs * rhs + addend
+        [[nodiscard]] friend Pack fmadd(const Pack& lhs, const Pack& rhs, const Pack& addend) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] * rhs.values_[i] + addend.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack sqrt(const Pack& pack) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = std::sqrt(pack.values_[i]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack operator-(const Pack& pack) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = -pack.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Mask<T, Lanes> operator==(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::equal_to<>{}); }
+        [[nodiscard]] friend Mask<T, Lanes> operator!=(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::not_equal_to<>{}); }
+        [[nodiscard]] friend Mask<T, Lanes> operator<(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::less<>{}); }
+        [[nodiscard]] friend Mask<T, Lanes> operator<=(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::less_equal<>{}); }
+        [[nodiscard]] friend Mask<T, Lanes> operator>(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::greater<>{}); }
+        [[nodiscard]] friend Mask<T, Lanes> operator>=(const Pack& lhs, const Pack& rhs) noexcept { return compare(lhs, rhs, std::greater_equal<>{}); }
+
+        // Lanes of if_true where mask is set, of if_false elsewhere
+        [[nodiscard]] friend Pack select(const Mask<T, Lanes>& mask, const Pack& if_true, const Pack& if_false) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = mask.values_[i] ? if_true.values_[i] : if_false.values_[i];
+            }
+            return result;
+        }
+
+        // Like the min and max instructions, the second operand is returned when a lane is NaN
+        [[nodiscard]] friend Pack min(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] < rhs.values_[i] ? lhs.values_[i] : rhs.values_[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend Pack max(const Pack& lhs, const Pack& rhs) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = lhs.values_[i] > rhs.values_[i] ? lhs.values_[i] : rhs.values_[i];
+            }
+            return result;
+        }
+
+        // Bitwise operations and shifts for integer lanes, used by lane-wise hashing
+        [[nodiscard]] friend Pack operator&(const Pack& lhs, const Pack& rhs) noexcept requires std::integral<T>
+        {
+            return combine(lhs, rhs, [](value_type l, value_type r) { return static_cast<value_type>(l & r); });
+        }
+
+        [[nodiscard]] friend Pack operator|(const Pack& lhs, const Pack& rhs) noexcept requires std::integral<T>
+        {
+            return combine(lhs, rhs, [](value_type l, value_type r) { return static_cast<value_type>(l | r); });
+        }
+
+        [[nodiscard]] friend Pack operator^(const Pack& lhs, const Pack& rhs) noexcept requires std::integral<T>
+        {
+            return combine(lhs, rhs, [](value_type l, value_type r) { return static_cast<value_type>(l ^ r); });
+        }
+
+        [[nodiscard]] friend Pack operator<<(const Pack& pack, unsigned count) noexcept requires std::integral<T>
+        {
+            return combine(pack, pack, [count](value_type l, value_type) { return static_cast<value_type>(l << count); });
+        }
+
+        [[nodiscard]] friend Pack operator>>(const Pack& pack, unsigned count) noexcept requires std::integral<T>
+        {
+            return combine(pack, pack, [count](value_type l, value_type) { return static_cast<value_type>(l >> count); });
+        }
+
+        std::array<value_type, Lanes> values_; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    private:
+        template<typename Compare>
+        [[nodiscard]] static Mask<T, Lanes> compare(const Pack& lhs, const Pack& rhs, Compare compare) noexcept
+        {
+            Mask<T, Lanes> result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = compare(lhs.values_[i], rhs.values_[i]);
+            }
+            return result;
+        }
+
+        template<typename Operation>
+        [[nodiscard]] static Pack combine(const Pack& lhs, const Pack& rhs, Operation operation) noexcept
+        {
+            Pack result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result.values_[i] = operation(lhs.values_[i], rhs.values_[i]);
+            }
+            return result;
+        }
+    };
+
+#if defined(ORION_MATH_SSE2)
+    template<>
+    struct Mask<float, 4> {
+        using value_type = float;
+        static constexpr std::size_t lanes = 4;
+
+        [[nodiscard]] static Mask broadcast(bool value) noexcept { return {_mm_castsi128_ps(_mm_set1_epi32(value ? -1 : 0))}; }
+        [[nodiscard]] bool operator[](std::size_t lane) const noexcept { return ((bits() >> lane) & 1U) != 0; }
+        [[nodiscard]] unsigned bits() const noexcept { return static_cast<unsigned>(_mm_movemask_ps(native_)); }
+
+        [[nodiscard]] friend Mask operator&(Mask lhs, Mask rhs) noexcept { return {_mm_and_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator|(Mask lhs, Mask rhs) noexcept { return {_mm_or_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator^(Mask lhs, Mask rhs) noexcept { return {_mm_xor_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator!(Mask mask) noexcept { return {_mm_xor_ps(mask.native_, broadcast(true).native_)}; }
+
+        __m128 native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<>
+    struct Pack<float, 4> {
+        using value_type = float;
+        static constexpr std::size_t lanes = 4;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept { return {_mm_set1_ps(value)}; }
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept { return {_mm_loadu_ps(ptr)}; }
+        void store(value_type* ptr) const noexcept { _mm_storeu_ps(ptr, native_); }
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept
+        {
+            alignas(16) std::array<value_type, lanes> values;
+            _mm_store_ps(values.data(), native_);
+            return values[lane];
+        }
+
+        [[nodiscard]] friend Pack operator+(Pack lhs, Pack rhs) noexcept { return {_mm_add_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack lhs, Pack rhs) noexcept { return {_mm_sub_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator*(Pack lhs, Pack rhs) noexcept { return {_mm_mul_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator/(Pack lhs, Pack rhs) noexcept { return {_mm_div_ps(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack fmadd(Pack lhs, Pack rhs, Pack addend) noexcept
+        {
+    #if defined(ORION_MATH_FMA)
+            return {_mm_fmadd_ps(lhs.native_, rhs.native_, addend.native_)};
+    #else
+            return {_mm_add_ps(_mm_mul_ps(lhs.native_, rhs.native_), addend.native_)};
+    #endif
+        }
+
+        [[nodiscard]] friend Pack sqrt(Pack pack) noexcept { return {_mm_sqrt_ps(pack.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack pack) noexcept { return {_mm_xor_ps(pack.native_, _mm_set1_ps(-0.f))}; }
+
+        [[nodiscard]] friend Mask<float, 4> operator==(Pack lhs, Pack rhs) noexcept { return {_mm_cmpeq_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask<float, 4> operator!=(Pack lhs, Pack rhs) noexcept { return {_mm_cmpneq_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask<float, 4> operator<(Pack lhs, Pack rhs) noexcept { return {_mm_cmplt_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask<float, 4> operator<=(Pack lhs, Pack rhs) noexcept { return {_mm_cmple_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask<float, 4> operator>(Pack lhs, Pack rhs) noexcept { return {_mm_cmpgt_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask<float, 4> operator>=(Pack lhs, Pack rhs) noexcept { return {_mm_cmpge_ps(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack select(Mask<float, 4> mask, Pack if_true, Pack if_false) noexcept
+        {
+            return {_mm_or_ps(_mm_and_ps(mask.native_, if_true.native_), _mm_andnot_ps(mask.native_, if_false.native_))};
+        }
+
+        [[nodiscard]] friend Pack min(Pack lhs, Pack rhs) noexcept { return {_mm_min_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack max(Pack lhs, Pack rhs) noexcept { return {_mm_max_ps(lhs.native_, rhs.native_)}; }
+
+        __m128 native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+#endif
+
+#if defined(ORION_MATH_AVX)
+    template<>
+    struct Mask<double, 4> {
+        using value_type = double;
+        static constexpr std::size_t lanes = 4;
+
+        [[nodiscard]] static Mask broadcast(bool value) noexcept { return {_mm256_castsi256_pd(_mm256_set1_epi64x(value ? -1 : 0))}; }
+        [[nodiscard]] bool operator[](std::size_t lane) const noexcept { return ((bits() >> lane) & 1U) != 0; }
+        [[nodiscard]] unsigned bits() const noexcept { return static_cast<unsigned>(_mm256_movemask_pd(native_)); }
+
+        [[nodiscard]] friend Mask operator&(Mask lhs, Mask rhs) noexcept { return {_mm256_and_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator|(Mask lhs, Mask rhs) noexcept { return {_mm256_or_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator^(Mask lhs, Mask rhs) noexcept { return {_mm256_xor_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator!(Mask mask) noexcept { return {_mm256_xor_pd(mask.native_, broadcast(true).native_)}; }
+
+        __m256d native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<>
+    struct Pack<double, 4> {
+        using value_type = double;
+        static constexpr std::size_t lanes = 4;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept { return {_mm256_set1_pd(value)}; }
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept { return {_mm256_loadu_pd(ptr)}; }
+        void store(value_type* ptr) const noexcept { _mm256_storeu_pd(ptr, native_); }
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept
+        {
+            alignas(32) std::array<value_type, lanes> values;
+            _mm256_store_pd(values.data(), native_);
+            return values[lane];
+        }
+
+        [[nodiscard]] friend Pack operator+(Pack lhs, Pack rhs) noexcept { return {_mm256_add_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack lhs, Pack rhs) noexcept { return {_mm256_sub_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator*(Pack lhs, Pack rhs) noexcept { return {_mm256_mul_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator/(Pack lhs, Pack rhs) noexcept { return {_mm256_div_pd(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack fmadd(Pack lhs, Pack rhs, Pack addend) noexcept
+        {
+    #if defined(ORION_MATH_FMA)
+            return {_mm256_fmadd_pd(lhs.native_, rhs.native_, addend.native_)};
+    #else
+            return {_mm256_add_pd(_mm256_mul_pd(lhs.native_, rhs.native_), addend.native_)};
+    #endif
+        }
+
+        [[nodiscard]] friend Pack sqrt(Pack pack) noexcept { return {_mm256_sqrt_pd(pack.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack pack) noexcept { return {_mm256_xor_pd(pack.native_, _mm256_set1_pd(-0.0))}; }
+
+        [[nodiscard]] friend Mask<double, 4> operator==(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_EQ_OQ)}; }
+        [[nodiscard]] friend Mask<double, 4> operator!=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_NEQ_UQ)}; }
+        [[nodiscard]] friend Mask<double, 4> operator<(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_LT_OQ)}; }
+        [[nodiscard]] friend Mask<double, 4> operator<=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_LE_OQ)}; }
+        [[nodiscard]] friend Mask<double, 4> operator>(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_GT_OQ)}; }
+        [[nodiscard]] friend Mask<double, 4> operator>=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_pd(lhs.native_, rhs.native_, _CMP_GE_OQ)}; }
+
+        [[nodiscard]] friend Pack select(Mask<double, 4> mask, Pack if_true, Pack if_false) noexcept
+        {
+            return {_mm256_blendv_pd(if_false.native_, if_true.native_, mask.native_)};
+        }
+
+        [[nodiscard]] friend Pack min(Pack lhs, Pack rhs) noexcept { return {_mm256_min_pd(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack max(Pack lhs, Pack rhs) noexcept { return {_mm256_max_pd(lhs.native_, rhs.native_)}; }
+
+        __m256d native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<>
+    struct Mask<float, 8> {
+        using value_type = float;
+        static constexpr std::size_t lanes = 8;
+
+        [[nodiscard]] static Mask broadcast(bool value) noexcept { return {_mm256_castsi256_ps(_mm256_set1_epi32(value ? -1 : 0))}; }
+        [[nodiscard]] bool operator[](std::size_t lane) const noexcept { return ((bits() >> lane) & 1U) != 0; }
+        [[nodiscard]] unsigned bits() const noexcept { return static_cast<unsigned>(_mm256_movemask_ps(native_)); }
+
+        [[nodiscard]] friend Mask operator&(Mask lhs, Mask rhs) noexcept { return {_mm256_and_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator|(Mask lhs, Mask rhs) noexcept { return {_mm256_or_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator^(Mask lhs, Mask rhs) noexcept { return {_mm256_xor_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Mask operator!(Mask mask) noexcept { return {_mm256_xor_ps(mask.native_, broadcast(true).native_)}; }
+
+        __m256 native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<>
+    struct Pack<float, 8> {
+        using value_type = float;
+        static constexpr std::size_t lanes = 8;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept { return {_mm256_set1_ps(value)}; }
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept { return {_mm256_loadu_ps(ptr)}; }
+        void store(value_type* ptr) const noexcept { _mm256_storeu_ps(ptr, native_); }
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept
+        {
+            alignas(32) std::array<value_type, lanes> values;
+            _mm256_store_ps(values.data(), native_);
+            return values[lane];
+        }
+
+        [[nodiscard]] friend Pack operator+(Pack lhs, Pack rhs) noexcept { return {_mm256_add_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack lhs, Pack rhs) noexcept { return {_mm256_sub_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator*(Pack lhs, Pack rhs) noexcept { return {_mm256_mul_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator/(Pack lhs, Pack rhs) noexcept { return {_mm256_div_ps(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack fmadd(Pack lhs, Pack rhs, Pack addend) noexcept
+        {
+    #if defined(ORION_MATH_FMA)
+            return {_mm256_fmadd_ps(lhs.native_, rhs.native_, addend.native_)};
+    #else
+            return {_mm256_add_ps(_mm256_mul_ps(lhs.native_, rhs.native_), addend.native_)};
+    #endif
+        }
+
+        [[nodiscard]] friend Pack sqrt(Pack pack) noexcept { return {_mm256_sqrt_ps(pack.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack pack) noexcept { return {_mm256_xor_ps(pack.native_, _mm256_set1_ps(-0.f))}; }
+
+        [[nodiscard]] friend Mask<float, 8> operator==(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_EQ_OQ)}; }
+        [[nodiscard]] friend Mask<float, 8> operator!=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_NEQ_UQ)}; }
+        [[nodiscard]] friend Mask<float, 8> operator<(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_LT_OQ)}; }
+        [[nodiscard]] friend Mask<float, 8> operator<=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_LE_OQ)}; }
+        [[nodiscard]] friend Mask<float, 8> operator>(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_GT_OQ)}; }
+        [[nodiscard]] friend Mask<float, 8> operator>=(Pack lhs, Pack rhs) noexcept { return {_mm256_cmp_ps(lhs.native_, rhs.native_, _CMP_GE_OQ)}; }
+
+        [[nodiscard]] friend Pack select(Mask<float, 8> mask, Pack if_true, Pack if_false) noexcept
+        {
+            return {_mm256_blendv_ps(if_false.native_, if_true.native_, mask.native_)};
+        }
+
+        [[nodiscard]] friend Pack min(Pack lhs, Pack rhs) noexcept { return {_mm256_min_ps(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack max(Pack lhs, Pack rhs) noexcept { return {_mm256_max_ps(lhs.native_, rhs.native_)}; }
+
+        __m256 native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+#endif
+
+    template<typename T>
+    concept Lane32 = std::integral<T> && sizeof(T) == 4;
+
+#if defined(ORION_MATH_SSE2)
+    // 32 bit integer lanes. Native integer packs carry the arithmetic, bitwise
+    // and shift operations lane-wise hashing needs; all of them wrap on overflow.
+    template<Lane32 T>
+    struct Pack<T, 4> {
+        using value_type = T;
+        static constexpr std::size_t lanes = 4;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept { return {_mm_set1_epi32(static_cast<int>(value))}; }
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept { return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))}; } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        void store(value_type* ptr) const noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), native_); }                         // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept
+        {
+            alignas(16) std::array<value_type, lanes> values;
+            _mm_store_si128(reinterpret_cast<__m128i*>(values.data()), native_); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return values[lane];
+        }
+
+        [[nodiscard]] friend Pack operator+(Pack lhs, Pack rhs) noexcept { return {_mm_add_epi32(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack lhs, Pack rhs) noexcept { return {_mm_sub_epi32(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack operator*(Pack lhs, Pack rhs) noexcept
+        {
+    #if defined(ORION_MATH_SSE41)
+            return {_mm_mullo_epi32(lhs.native_, rhs.native_)};
+    #else
+            // Low halves of the even and odd lane products, interleaved back
+            const auto even = _mm_mul_epu32(lhs.native_, rhs.native_);
+            const auto odd = _mm_mul_epu32(_mm_srli_epi64(lhs.native_, 32), _mm_srli_epi64(rhs.native_, 32));
+            return {_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)))};
+    #endif
+        }
+
+        [[nodiscard]] friend Pack operator&(Pack lhs, Pack rhs) noexcept { return {_mm_and_si128(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator|(Pack lhs, Pack rhs) noexcept { return {_mm_or_si128(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator^(Pack lhs, Pack rhs) noexcept { return {_mm_xor_si128(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator<<(Pack pack, unsigned count) noexcept { return {_mm_sll_epi32(pack.native_, _mm_cvtsi32_si128(static_cast<int>(count)))}; }
+
+        // Logical shift for unsigned lanes, arithmetic for signed ones
+        [[nodiscard]] friend Pack operator>>(Pack pack, unsigned count) noexcept
+        {
+            const auto shift = _mm_cvtsi32_si128(static_cast<int>(count));
+            if constexpr (std::is_signed_v<T>) {
+                return {_mm_sra_epi32(pack.native_, shift)};
+            } else {
+                return {_mm_srl_epi32(pack.native_, shift)};
+            }
+        }
+
+        __m128i native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+#endif
+
+#if defined(ORION_MATH_AVX2)
+    template<Lane32 T>
+    struct Pack<T, 8> {
+        using value_type = T;
+        static constexpr std::size_t lanes = 8;
+
+        [[nodiscard]] static Pack broadcast(value_type value) noexcept { return {_mm256_set1_epi32(static_cast<int>(value))}; }
+        [[nodiscard]] static Pack load(const value_type* ptr) noexcept { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))}; } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        void store(value_type* ptr) const noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), native_); }                         // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        [[nodiscard]] value_type operator[](std::size_t lane) const noexcept
+        {
+            alignas(32) std::array<value_type, lanes> values;
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values.data()), native_); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return values[lane];
+        }
+
+        [[nodiscard]] friend Pack operator+(Pack lhs, Pack rhs) noexcept { return {_mm256_add_epi32(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator-(Pack lhs, Pack rhs) noexcept { return {_mm256_sub_epi32(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator*(Pack lhs, Pack rhs) noexcept { return {_mm256_mullo_epi32(lhs.native_, rhs.native_)}; }
+
+        [[nodiscard]] friend Pack operator&(Pack lhs, Pack rhs) noexcept { return {_mm256_and_si256(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator|(Pack lhs, Pack rhs) noexcept { return {_mm256_or_si256(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator^(Pack lhs, Pack rhs) noexcept { return {_mm256_xor_si256(lhs.native_, rhs.native_)}; }
+        [[nodiscard]] friend Pack operator<<(Pack pack, unsigned count) noexcept { return {_mm256_sll_epi32(pack.native_, _mm_cvtsi32_si128(static_cast<int>(count)))}; }
+
+        [[nodiscard]] friend Pack operator>>(Pack pack, unsigned count) noexcept
+        {
+            const auto shift = _mm_cvtsi32_si128(static_cast<int>(count));
+            if constexpr (std::is_signed_v<T>) {
+                return {_mm256_sra_epi32(pack.native_, shift)};
+            } else {
+                return {_mm256_srl_epi32(pack.native_, shift)};
+            }
+        }
+
+        __m256i native_; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+#endif
+
+    // Lane-wise static_cast between packs of the same width, such as floats to
+    // lattice coordinates. Float to integer conversion truncates towards zero.
+    template<typename To, typename From, std::size_t Lanes>
+    [[nodiscard]] Pack<To, Lanes> convert(const Pack<From, Lanes>& pack) noexcept
+    {
+        std::array<From, Lanes> from;
+        pack.store(from.data());
+        std::array<To, Lanes> to;
+        for (std::size_t i = 0; i < Lanes; ++i) {
+            to[i] = static_cast<To>(from[i]);
+        }
+        return Pack<To, Lanes>::load(to.data());
+    }
+
+#if defined(ORION_MATH_SSE2)
+    template<>
+    [[nodiscard]] inline Pack<std::int32_t, 4> convert<std::int32_t>(const Pack<float, 4>& pack) noexcept
+    {
+        return {_mm_cvttps_epi32(pack.native_)};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<float, 4> convert<float>(const Pack<std::int32_t, 4>& pack) noexcept
+    {
+        return {_mm_cvtepi32_ps(pack.native_)};
+    }
+
+    // Same bits, two's complement reinterpretation
+    template<>
+    [[nodiscard]] inline Pack<std::uint32_t, 4> convert<std::uint32_t>(const Pack<std::int32_t, 4>& pack) noexcept
+    {
+        return {pack.native_};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<std::int32_t, 4> convert<std::int32_t>(const Pack<std::uint32_t, 4>& pack) noexcept
+    {
+        return {pack.native_};
+    }
+#endif
+
+#if defined(ORION_MATH_AVX)
+    template<>
+    [[nodiscard]] inline Pack<std::int32_t, 4> convert<std::int32_t>(const Pack<double, 4>& pack) noexcept
+    {
+        return {_mm256_cvttpd_epi32(pack.native_)};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<double, 4> convert<double>(const Pack<std::int32_t, 4>& pack) noexcept
+    {
+        return {_mm256_cvtepi32_pd(pack.native_)};
+    }
+#endif
+
+#if defined(ORION_MATH_AVX2)
+    template<>
+    [[nodiscard]] inline Pack<std::int32_t, 8> convert<std::int32_t>(const Pack<float, 8>& pack) noexcept
+    {
+        return {_mm256_cvttps_epi32(pack.native_)};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<float, 8> convert<float>(const Pack<std::int32_t, 8>& pack) noexcept
+    {
+        return {_mm256_cvtepi32_ps(pack.native_)};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<std::uint32_t, 8> convert<std::uint32_t>(const Pack<std::int32_t, 8>& pack) noexcept
+    {
+        return {pack.native_};
+    }
+
+    template<>
+    [[nodiscard]] inline Pack<std::int32_t, 8> convert<std::int32_t>(const Pack<std::uint32_t, 8>& pack) noexcept
+    {
+        return {pack.native_};
+    }
+#endif
+
+    // Lane j of rows[i] moves to lane i of rows[j], turning four packs of
+    // per-item rows into one pack per component across the items
+    template<typename T>
+    void transpose(std::array<Pack<T, 4>, 4>& rows) noexcept
+    {
+        std::array<std::array<T, 4>, 4> values;
+        for (std::size_t i = 0; i < 4; ++i) {
+            rows[i].store(values[i].data());
+        }
+        for (std::size_t i = 0; i < 4; ++i) {
+            const std::array<T, 4> column{values[0][i], values[1][i], values[2][i], values[3][i]};
+            rows[i] = Pack<T, 4>::load(column.data());
+        }
+    }
+
+#if defined(ORION_MATH_SSE2)
+    template<>
+    inline void transpose<float>(std::array<Pack<float, 4>, 4>& rows) noexcept
+    {
+        _MM_TRANSPOSE4_PS(rows[0].native_, rows[1].native_, rows[2].native_, rows[3].native_);
+    }
+#endif
+
+#if defined(ORION_MATH_AVX)
+    template<>
+    inline void transpose<double>(std::array<Pack<double, 4>, 4>& rows) noexcept
+    {
+        // Pairs within each 128 bit half, then halves across the pairs
+        const auto even_low = _mm256_unpacklo_pd(rows[0].native_, rows[1].native_);
+        const auto odd_low = _mm256_unpackhi_pd(rows[0].native_, rows[1].native_);
+        const auto even_high = _mm256_unpacklo_pd(rows[2].native_, rows[3].native_);
+        const auto odd_high = _mm256_unpackhi_pd(rows[2].native_, rows[3].native_);
+        rows[0].native_ = _mm256_permute2f128_pd(even_low, even_high, 0x20);
+        rows[1].native_ = _mm256_permute2f128_pd(odd_low, odd_high, 0x20);
+        rows[2].native_ = _mm256_permute2f128_pd(even_low, even_high, 0x31);
+        rows[3].native_ = _mm256_permute2f128_pd(odd_low, odd_high, 0x31);
+    }
+#endif
+} // namespace orion::math::simd
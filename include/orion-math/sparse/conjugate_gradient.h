@@ -0,0 +1,336 @@
+#pragma once
+
+#include "csr.h"
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for, parallel_chunk_count
+
+#include <algorithm>   // std::copy, std::fill
+#include <barrier>     // std::barrier
+#include <cmath>       // std::sqrt
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <numeric>     // std::accumulate
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+#include <type_traits> // std::type_identity_t, std::is_same_v
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    enum class Preconditioner {
+        none,
+        // Inverse of the diagonal, or of each diagonal block for block matrices
+        jacobi,
+        // Zero fill-in incomplete Cholesky factor of the lower triangle. Scalar
+        // matrices only; its triangular solves run on the calling thread.
+        incomplete_cholesky,
+    };
+
+    template<typename T>
+    struct ConjugateGradientSettings {
+        Preconditioner preconditioner = Preconditioner::jacobi;
+        // Stops once |b - Ax| <= tolerance * |b|
+        T tolerance = static_cast<T>(1e-6);
+        std::size_t max_iterations = 1000;
+        unsigned thread_count = 1;
+    };
+
+    template<typename T>
+    struct ConjugateGradientResult {
+        std::size_t iterations;
+        // |b - Ax| / |b| when the solver stopped
+        T relative_residual;
+        bool converged;
+    };
+
+    namespace detail
+    {
+        template<typename T>
+        [[nodiscard]] constexpr T inner(T lhs, T rhs) noexcept
+        {
+            return lhs * rhs;
+        }
+
+        template<typename T, std::size_t N>
+        [[nodiscard]] constexpr T inner(const Vector<T, N>& lhs, const Vector<T, N>& rhs) noexcept
+        {
+            return dot(lhs, rhs);
+        }
+
+        template<typename T>
+        [[nodiscard]] T inverse_diagonal(T value)
+        {
+            if (value == T{0}) {
+                throw std::invalid_argument("zero on the diagonal");
+            }
+            return T{1} / value;
+        }
+
+        // Transposed cofactor matrix over the determinant; the cofactor rows are
+        // cross products of the block rows
+        template<typename T>
+        [[nodiscard]] Matrix3_t<T> inverse_diagonal(const Matrix3_t<T>& block)
+        {
+            const auto cofactor0 = cross(block[1], block[2]);
+            const auto cofactor1 = cross(block[2], block[0]);
+            const auto cofactor2 = cross(block[0], block[1]);
+            const auto determinant = dot(block[0], cofactor0);
+            if (determinant == T{0}) {
+                throw std::invalid_argument("singular diagonal block");
+            }
+            const Matrix3_t<T> adjugate{
+                cofactor0[0], cofactor1[0], cofactor2[0],
+                cofactor0[1], cofactor1[1], cofactor2[1],
+                cofactor0[2], cofactor1[2], cofactor2[2]};
+            return adjugate * (T{1} / determinant);
+        }
+
+        template<typename Entry>
+        [[nodiscard]] std::vector<Entry> inverse_diagonals(const CsrMatrix<Entry>& matrix)
+        {
+            std::vector<Entry> result(matrix.rows());
+            for (std::size_t row = 0; row < matrix.rows(); ++row) {
+                const auto index = matrix.find(row, row);
+                if (index == matrix.nonzeros()) {
+                    throw std::invalid_argument("matrix is missing a diagonal entry");
+                }
+                result[row] = inverse_diagonal(matrix.values()[index]);
+            }
+            return result;
+        }
+
+        // Lower triangular factor L with the sparsity of the lower triangle of A
+        // and L * L^T matching A on that pattern. The diagonal is the last entry of each row.
+        template<typename T>
+        [[nodiscard]] CsrMatrix<T> incomplete_cholesky(const CsrMatrix<T>& matrix)
+        {
+            const auto offsets = matrix.row_offsets();
+            const auto columns = matrix.column_indices();
+            const auto values = matrix.values();
+
+            std::vector<std::uint32_t> lower_offsets(matrix.rows() + 1, 0);
+            std::vector<std::uint32_t> lower_columns;
+            std::vector<T> lower_values;
+            for (std::size_t row = 0; row < matrix.rows(); ++row) {
+                for (auto k = offsets[row]; k < offsets[row + 1] && columns[k] <= row; ++k) {
+                    lower_columns.push_back(columns[k]);
+                    lower_values.push_back(values[k]);
+                }
+                lower_offsets[row + 1] = static_cast<std::uint32_t>(lower_columns.size());
+                if (lower_columns.size() == lower_offsets[row] || lower_columns.back() != row) {
+                    throw std::invalid_argument("matrix is missing a diagonal entry");
+                }
+            }
+
+            for (std::size_t row = 0; row < matrix.rows(); ++row) {
+                for (auto entry = lower_offsets[row]; entry < lower_offsets[row + 1]; ++entry) {
+                    const auto column = lower_columns[entry];
+                    // Sum of L[row][j] * L[column][j] over the shared columns j < column
+                    auto sum = T{0};
+                    auto lhs = lower_offsets[row];
+                    auto rhs = lower_offsets[column];
+                    const auto rhs_end = lower_offsets[column + 1] - 1;
+                    while (lhs < entry && rhs < rhs_end) {
+                        if (lower_columns[lhs] == lower_columns[rhs]) {
+                            sum += lower_values[lhs++] * lower_values[rhs++];
+                        } else if (lower_columns[lhs] < lower_columns[rhs]) {
+                            ++lhs;
+                        } else {
+                            ++rhs;
+                        }
+                    }
+
+                    const auto value = lower_values[entry] - sum;
+                    if (column < row) {
+                        lower_values[entry] = value / lower_values[rhs_end];
+                    } else if (value > T{0}) {
+                        lower_values[entry] = std::sqrt(value);
+                    } else {
+                        throw std::invalid_argument("incomplete Cholesky factorization broke down, matrix is not positive definite");
+                    }
+                }
+            }
+            return CsrMatrix<T>{matrix.rows(), matrix.columns(), std::move(lower_offsets), std::move(lower_columns), std::move(lower_values)};
+        }
+
+        // Solves L * L^T * result = residual
+        template<typename T>
+        void cholesky_solve(const CsrMatrix<T>& factor, std::span<const T> residual, std::span<T> result) noexcept
+        {
+            const auto offsets = factor.row_offsets();
+            const auto columns = factor.column_indices();
+            const auto values = factor.values();
+            for (std::size_t row = 0; row < factor.rows(); ++row) {
+                auto value = residual[row];
+                const auto diagonal = offsets[row + 1] - 1;
+                for (auto k = offsets[row]; k < diagonal; ++k) {
+                    value -= values[k] * result[columns[k]];
+                }
+                result[row] = value / values[diagonal];
+            }
+            for (auto row = factor.rows(); row-- > 0;) {
+                const auto diagonal = offsets[row + 1] - 1;
+                result[row] /= values[diagonal];
+                for (auto k = offsets[row]; k < diagonal; ++k) {
+                    result[columns[k]] -= values[k] * result[row];
+                }
+            }
+        }
+    } // namespace detail
+
+    // Preconditioned conjugate gradient for symmetric positive definite systems.
+    // x holds the initial guess and receives the solution. The rows are split
+    // across settings.thread_count threads once for the whole solve; each thread
+    // runs every iteration on its own rows and the threads meet at a barrier
+    // where a step needs the others' results, so no threads are started per iteration.
+    template<typename Entry>
+    ConjugateGradientResult<csr_scalar_t<Entry>> conjugate_gradient(const CsrMatrix<Entry>& matrix,
+                                                                    std::type_identity_t<std::span<const csr_vector_t<Entry>>> b,
+                                                                    std::type_identity_t<std::span<csr_vector_t<Entry>>> x,
+                                                                    const ConjugateGradientSettings<csr_scalar_t<Entry>>& settings = {})
+    {
+        using T = csr_scalar_t<Entry>;
+        using V = csr_vector_t<Entry>;
+        const auto count = matrix.rows();
+        if (matrix.columns() != count || b.size() != count || x.size() != count) {
+            throw std::invalid_argument("conjugate gradient needs a square matrix and matching vectors");
+        }
+        if (count == 0) {
+            return {0, T{0}, true};
+        }
+
+        std::vector<Entry> inverse_diagonals;
+        CsrMatrix<Entry> factor;
+        switch (settings.preconditioner) {
+            case Preconditioner::none:
+                break;
+            case Preconditioner::jacobi:
+                inverse_diagonals = detail::inverse_diagonals(matrix);
+                break;
+            case Preconditioner::incomplete_cholesky:
+                if constexpr (std::is_same_v<Entry, T>) {
+                    factor = detail::incomplete_cholesky(matrix);
+                } else {
+                    throw std::invalid_argument("incomplete Cholesky needs a scalar matrix");
+                }
+                break;
+        }
+
+        const auto threads = settings.thread_count;
+        const auto chunks = parallel_chunk_count(count, threads);
+        std::vector<V> residual(count);
+        std::vector<V> preconditioned(count);
+        std::vector<V> direction(count);
+        std::vector<V> product(count);
+        // One partial sum per chunk for each reduction of an iteration. A buffer
+        // is only written again after a later barrier, once every thread has read it.
+        std::vector<T> curvature_partials(chunks);
+        std::vector<T> residual_partials(chunks);
+        std::vector<T> rz_partials(chunks);
+        std::barrier sync{static_cast<std::ptrdiff_t>(chunks)};
+        ConjugateGradientResult<T> result{};
+
+        // Nothing in the region throws, so no thread can leave the others waiting at the barrier
+        parallel_for(count, threads, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+            // Every thread sums the partials in the same order and gets the same value
+            auto reduce = [&](std::vector<T>& partials, T partial) {
+                partials[chunk] = partial;
+                sync.arrive_and_wait();
+                return std::accumulate(partials.begin(), partials.end(), T{0});
+            };
+            auto multiply_rows = [&](std::span<const V> vector) {
+                if (chunk == 0) {
+                    ORION_MATH_INSTRUMENT_BATCH(matrix.nonzeros());
+                }
+                detail::multiply_rows(matrix, vector, std::span<V>{product}, begin, end);
+            };
+            // Preconditions the residual, which is complete after the barrier of
+            // the |r|^2 reduction, and returns r . z
+            auto precondition = [&] {
+                switch (settings.preconditioner) {
+                    case Preconditioner::none:
+                        std::copy(residual.begin() + static_cast<std::ptrdiff_t>(begin), residual.begin() + static_cast<std::ptrdiff_t>(end), preconditioned.begin() + static_cast<std::ptrdiff_t>(begin));
+                        break;
+                    case Preconditioner::jacobi:
+                        for (std::size_t i = begin; i < end; ++i) {
+                            preconditioned[i] = inverse_diagonals[i] * residual[i];
+                        }
+                        break;
+                    case Preconditioner::incomplete_cholesky:
+                        if constexpr (std::is_same_v<Entry, T>) {
+                            if (chunk == 0) {
+                                detail::cholesky_solve<T>(factor, residual, preconditioned);
+                            }
+                            sync.arrive_and_wait();
+                        }
+                        break;
+                }
+                auto rz = T{0};
+                for (std::size_t i = begin; i < end; ++i) {
+                    rz += detail::inner(residual[i], preconditioned[i]);
+                }
+                return rz;
+            };
+
+            auto b_squared = T{0};
+            for (std::size_t i = begin; i < end; ++i) {
+                b_squared += detail::inner(b[i], b[i]);
+            }
+            const auto b_norm = std::sqrt(reduce(rz_partials, b_squared));
+            if (b_norm == T{0}) {
+                std::fill(x.begin() + static_cast<std::ptrdiff_t>(begin), x.begin() + static_cast<std::ptrdiff_t>(end), V{});
+                if (chunk == 0) {
+                    result = {0, T{0}, true};
+                }
+                return;
+            }
+
+            multiply_rows(std::span<const V>{x});
+            auto residual_squared = T{0};
+            for (std::size_t i = begin; i < end; ++i) {
+                residual[i] = b[i] - product[i];
+                residual_squared += detail::inner(residual[i], residual[i]);
+            }
+            auto residual_norm = std::sqrt(reduce(residual_partials, residual_squared));
+            auto rz_partial = precondition();
+            std::copy(preconditioned.begin() + static_cast<std::ptrdiff_t>(begin), preconditioned.begin() + static_cast<std::ptrdiff_t>(end), direction.begin() + static_cast<std::ptrdiff_t>(begin));
+            auto rz = reduce(rz_partials, rz_partial);
+
+            std::size_t iteration = 0;
+            while (residual_norm > settings.tolerance * b_norm && iteration < settings.max_iterations) {
+                ++iteration;
+                multiply_rows(std::span<const V>{direction});
+                auto curvature = T{0};
+                for (std::size_t i = begin; i < end; ++i) {
+                    curvature += detail::inner(direction[i], product[i]);
+                }
+                const auto alpha = rz / reduce(curvature_partials, curvature);
+
+                // Updates the solution and residual and reduces |r|^2 in the same pass
+                residual_squared = T{0};
+                for (std::size_t i = begin; i < end; ++i) {
+                    x[i] = x[i] + direction[i] * alpha;
+                    residual[i] = residual[i] - product[i] * alpha;
+                    residual_squared += detail::inner(residual[i], residual[i]);
+                }
+                residual_norm = std::sqrt(reduce(residual_partials, residual_squared));
+                if (residual_norm <= settings.tolerance * b_norm) {
+                    break;
+                }
+
+                const auto next_rz = reduce(rz_partials, precondition());
+                const auto beta = next_rz / rz;
+                rz = next_rz;
+                for (std::size_t i = begin; i < end; ++i) {
+                    direction[i] = preconditioned[i] + direction[i] * beta;
+                }
+                // The next product reads every thread's rows of the direction
+                sync.arrive_and_wait();
+            }
+
+            if (chunk == 0) {
+                result = {iteration, residual_norm / b_norm, residual_norm <= settings.tolerance * b_norm};
+            }
+        });
+        return result;
+    }
+} // namespace orion::math
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/matrix/matrix3.h"
+#include "orion-math/parallel.h" // parallel_for
+#include "orion-math/vector/vector3.h"
+
+#include <algorithm>   // std::adjacent_find, std::lower_bound, std::sort
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument, std::out_of_range
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace orion::math
+{
+    namespace detail
+    {
+        // Scalar entries act on scalars, N x N block entries on N component vectors
+        template<typename Entry>
+        struct csr_traits {
+            using scalar = Entry;
+            using vector = Entry;
+            static constexpr std::size_t block_size = 1;
+        };
+
+        template<typename T, std::size_t N>
+        struct csr_traits<Matrix<T, N, N>> {
+            using scalar = T;
+            using vector = Vector<T, N>;
+            static constexpr std::size_t block_size = N;
+        };
+    } // namespace detail
+
+    // Element type of the vectors a CsrMatrix<Entry> multiplies
+    template<typename Entry>
+    using csr_vector_t = typename detail::csr_traits<Entry>::vector;
+
+    template<typename Entry>
+    using csr_scalar_t = typename detail::csr_traits<Entry>::scalar;
+
+    // Matrix entry for building a sparse matrix from unordered input
+    template<typename Entry>
+    struct Triplet {
+        std::uint32_t row;
+        std::uint32_t column;
+        Entry value;
+    };
+
+    // Compressed sparse row matrix. Row i stores its entries at
+    // [row_offsets[i], row_offsets[i + 1]) with strictly increasing columns.
+    // Storage per nonzero is one Entry plus a 32 bit column index.
+    template<typename Entry>
+    class CsrMatrix
+    {
+    public:
+        using entry_type = Entry;
+        using vector_type = csr_vector_t<Entry>;
+        using size_type = std::size_t;
+
+        CsrMatrix() = default;
+
+        // Takes ownership of prebuilt arrays, throws std::invalid_argument when
+        // they do not describe a valid matrix
+        CsrMatrix(size_type rows, size_type columns, std::vector<std::uint32_t> row_offsets, std::vector<std::uint32_t> column_indices, std::vector<Entry> values)
+            : rows_(rows)
+            , columns_(columns)
+            , row_offsets_(std::move(row_offsets))
+            , column_indices_(std::move(column_indices))
+            , values_(std::move(values))
+        {
+            if (row_offsets_.size() != rows_ + 1 || row_offsets_.front() != 0 || row_offsets_.back() != values_.size() || column_indices_.size() != values_.size()) {
+                throw std::invalid_argument("row offsets must span all values");
+            }
+            // Every offset is checked before any of them is used to index the columns
+            for (size_type row = 0; row < rows_; ++row) {
+                if (row_offsets_[row] > row_offsets_[row + 1] || row_offsets_[row + 1] > values_.size()) {
+                    throw std::invalid_argument("row offsets must be non-decreasing and within the values");
+                }
+            }
+            for (size_type row = 0; row < rows_; ++row) {
+                const auto begin = column_indices_.begin() + row_offsets_[row];
+                const auto end = column_indices_.begin() + row_offsets_[row + 1];
+                if (std::adjacent_find(begin, end, [](auto lhs, auto rhs) { return lhs >= rhs; }) != end) {
+                    throw std::invalid_argument("columns must be strictly increasing within a row");
+                }
+                if (begin != end && *(end - 1) >= columns_) {
+                    throw std::out_of_range("column index out of range");
+                }
+            }
+        }
+
+        // Sorts the triplets and sums duplicates
+        [[nodiscard]] static CsrMatrix from_triplets(size_type rows, size_type columns, std::span<const Triplet<Entry>> triplets)
+        {
+            std::vector<Triplet<Entry>> sorted(triplets.begin(), triplets.end());
+            for (const auto& triplet : sorted) {
+                if (triplet.row >= rows || triplet.column >= columns) {
+                    throw std::out_of_range("triplet index out of range");
+                }
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.row != rhs.row ? lhs.row < rhs.row : lhs.column < rhs.column;
+            });
+
+            CsrMatrix result;
+            result.rows_ = rows;
+            result.columns_ = columns;
+            result.row_offsets_.assign(rows + 1, 0);
+            for (std::size_t i = 0; i < sorted.size(); ++i) {
+                const auto& triplet = sorted[i];
+                if (i > 0 && sorted[i - 1].row == triplet.row && sorted[i - 1].column == triplet.column) {
+                    result.values_.back() = result.values_.back() + triplet.value;
+                    continue;
+                }
+                ++result.row_offsets_[triplet.row + 1];
+                result.column_indices_.push_back(triplet.column);
+                result.values_.push_back(triplet.value);
+            }
+            for (size_type row = 0; row < rows; ++row) {
+                result.row_offsets_[row + 1] += result.row_offsets_[row];
+            }
+            return result;
+        }
+
+        [[nodiscard]] size_type rows() const noexcept { return rows_; }
+        [[nodiscard]] size_type columns() const noexcept { return columns_; }
+        [[nodiscard]] size_type nonzeros() const noexcept { return values_.size(); }
+
+        [[nodiscard]] std::span<const std::uint32_t> row_offsets() const noexcept { return row_offsets_; }
+        [[nodiscard]] std::span<const std::uint32_t> column_indices() const noexcept { return column_indices_; }
+        [[nodiscard]] std::span<const Entry> values() const noexcept { return values_; }
+        [[nodiscard]] std::span<Entry> values() noexcept { return values_; }
+
+        // Position of (row, column) in values(), or nonzeros() when it is not stored
+        [[nodiscard]] size_type find(size_type row, size_type column) const noexcept
+        {
+            const auto begin = column_indices_.begin() + row_offsets_[row];
+            const auto end = column_indices_.begin() + row_offsets_[row + 1];
+            const auto it = std::lower_bound(begin, end, column);
+            return it != end && *it == column ? static_cast<size_type>(it - column_indices_.begin()) : nonzeros();
+        }
+
+        // Stored value at (row, column), zero for entries outside the pattern
+        [[nodiscard]] Entry operator()(size_type row, size_type column) const noexcept
+        {
+            const auto index = find(row, column);
+            return index != nonzeros() ? values_[index] : Entry{};
+        }
+
+    private:
+        size_type rows_ = 0;
+        size_type columns_ = 0;
+        std::vector<std::uint32_t> row_offsets_{0};
+        std::vector<std::uint32_t> column_indices_;
+        std::vector<Entry> values_;
+    };
+
+    template<typename T>
+    using SparseMatrix = CsrMatrix<T>;
+
+    // Every entry is a 3x3 block acting on a Vector3, the layout of cloth and
+    // soft body systems with one block row per particle
+    template<typename T>
+    using BlockSparseMatrix3 = CsrMatrix<Matrix3_t<T>>;
+
+    namespace detail
+    {
+        template<typename Entry>
+        void multiply_rows(const CsrMatrix<Entry>& matrix, std::span<const csr_vector_t<Entry>> x, std::span<csr_vector_t<Entry>> y, std::size_t begin, std::size_t end) noexcept
+        {
+            const auto offsets = matrix.row_offsets();
+            const auto columns = matrix.column_indices();
+            const auto values = matrix.values();
+            for (std::size_t row = begin; row < end; ++row) {
+                csr_vector_t<Entry> sum{};
+                for (auto k = offsets[row]; k < offsets[row + 1]; ++k) {
+                    sum = sum + values[k] * x[columns[k]];
+                }
+                y[row] = sum;
+            }
+        }
+    } // namespace detail
+
+    // y = matrix * x with rows split across threads. y must not alias x.
+    template<typename Entry>
+    void multiply(const CsrMatrix<Entry>& matrix,
+                  std::type_identity_t<std::span<const csr_vector_t<Entry>>> x,
+                  std::type_identity_t<std::span<csr_vector_t<Entry>>> y,
+                  unsigned thread_count = 1)
+    {
+        if (x.size() != matrix.columns() || y.size() != matrix.rows()) {
+            throw std::invalid_argument("vector sizes must match the matrix");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(matrix.nonzeros());
+        parallel_for(matrix.rows(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+            detail::multiply_rows(matrix, x, y, begin, end);
+        });
+    }
+} // namespace orion::math
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/parallel.h"   // parallel_for, parallel_chunk_count
+#include "orion-math/vector/vector3.h"
+
+#include <algorithm> // std::fill, std::max
+#include <bit>       // std::bit_ceil, std::bit_width
+#include <cmath>     // std::floor
+#include <cstddef>   // std::ptrdiff_t, std::size_t
+#include <cstdint>   // std::int32_t, std::uint32_t
+#include <span>      // std::span
+#include <stdexcept> // std::invalid_argument
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+namespace orion::math
+{
+    // Uniform grid over unbounded space. Cells are hashed into a power of two
+    // table and points are radix sorted by bucket, so a build is a handful
+    // of flat arrays regardless of how many cells are occupied. Several cells
+    // may share a bucket; queries filter those out by recomputing each
+    // candidate's cell.
+    template<typename T = float>
+    class SpatialHashGrid
+    {
+    public:
+        using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+        // A bucket count of 0 picks the power of two at or above twice the point count on each build
+        explicit SpatialHashGrid(T cell_size, std::size_t bucket_count = 0)
+            : cell_size_(cell_size)
+            , inverse_cell_size_(T{1} / cell_size)
+            , requested_buckets_(bucket_count)
+        {
+            if (!(cell_size > T{0})) {
+                throw std::invalid_argument("cell size must be positive");
+            }
+        }
+
+        [[nodiscard]] T cell_size() const noexcept { return cell_size_; }
+        [[nodiscard]] std::size_t size() const noexcept { return indices_.size(); }
+        [[nodiscard]] std::size_t bucket_count() const noexcept { return bucket_starts_.empty() ? 0 : bucket_starts_.size() - 1; }
+
+        [[nodiscard]] Vector3_i cell_of(const Vector3_t<T>& position) const noexcept
+        {
+            return {
+                static_cast<std::int32_t>(std::floor(position[0] * inverse_cell_size_)),
+                static_cast<std::int32_t>(std::floor(position[1] * inverse_cell_size_)),
+                static_cast<std::int32_t>(std::floor(position[2] * inverse_cell_size_))};
+        }
+
+        // Replaces the contents with positions. Bucket keys are computed in
+        // parallel, (key, index) pairs are radix sorted with per-chunk histograms
+        // of radix_size entries, and bucket starts are read off the sorted keys.
+        // Scratch arrays are kept between builds, so rebuilding every frame does
+        // not allocate once the point count has settled.
+        void build(std::span<const Vector3_t<T>> positions, unsigned thread_count = 1)
+        {
+            ORION_MATH_INSTRUMENT_BATCH(positions.size());
+            const auto count = positions.size();
+            const auto buckets = requested_buckets_ != 0 ? std::bit_ceil(requested_buckets_) : std::bit_ceil(std::max<std::size_t>(count * 2, 1));
+            mask_ = static_cast<std::uint32_t>(buckets - 1);
+
+            keys_.resize(count);
+            indices_.resize(count);
+            parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    keys_[i] = bucket_of(cell_of(positions[i]));
+                    indices_[i] = static_cast<std::uint32_t>(i);
+                }
+            });
+            radix_sort(static_cast<unsigned>(std::bit_width(mask_)), thread_count);
+
+            // The slot holding the first key at or above a bucket is where that bucket starts
+            bucket_starts_.resize(buckets + 1);
+            positions_.resize(count);
+            parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t slot = begin; slot < end; ++slot) {
+                    const auto first_bucket = slot == 0 ? std::size_t{0} : std::size_t{keys_[slot - 1]} + 1;
+                    for (auto bucket = first_bucket; bucket <= keys_[slot]; ++bucket) {
+                        bucket_starts_[bucket] = static_cast<std::uint32_t>(slot);
+                    }
+                    positions_[slot] = positions[indices_[slot]];
+                }
+            });
+            const auto first_empty = count == 0 ? std::size_t{0} : std::size_t{keys_.back()} + 1;
+            std::fill(bucket_starts_.begin() + static_cast<std::ptrdiff_t>(first_empty), bucket_starts_.end(), static_cast<std::uint32_t>(count));
+        }
+
+        // Calls function(index) for every point within radius of center
+        template<typename Function>
+        void query_radius(const Vector3_t<T>& center, T radius, Function&& function) const
+        {
+            const Vector3_t<T> extent{radius, radius, radius};
+            const auto radius_squared = radius * radius;
+            for_each_candidate(center - extent, center + extent, [&](std::size_t slot) {
+                if ((positions_[slot] - center).sqr_magnitude() <= radius_squared) {
+                    function(indices_[slot]);
+                }
+            });
+        }
+
+        // Calls function(index) for every point inside the closed box [min, max]
+        template<typename Function>
+        void query_aabb(const Vector3_t<T>& min, const Vector3_t<T>& max, Function&& function) const
+        {
+            for_each_candidate(min, max, [&](std::size_t slot) {
+                const auto& position = positions_[slot];
+                if (position[0] >= min[0] && position[1] >= min[1] && position[2] >= min[2] &&
+                    position[0] <= max[0] && position[1] <= max[1] && position[2] <= max[2]) {
+                    function(indices_[slot]);
+                }
+            });
+        }
+
+        // Every pair of points within radius, each reported once as (smaller index, larger index).
+        // Chunks collect into their own lists which are concatenated in order,
+        // so the result does not depend on the thread count.
+        [[nodiscard]] std::vector<Pair> find_pairs(T radius, unsigned thread_count = 1) const
+        {
+            const auto count = size();
+            std::vector<std::vector<Pair>> chunk_pairs(parallel_chunk_count(count, thread_count));
+            parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+                auto& pairs = chunk_pairs[chunk];
+                for (std::size_t slot = begin; slot < end; ++slot) {
+                    const auto index = indices_[slot];
+                    query_radius(positions_[slot], radius, [&](std::uint32_t other) {
+                        if (index < other) {
+                            pairs.emplace_back(index, other);
+                        }
+                    });
+                }
+            });
+
+            std::vector<Pair> result;
+            for (const auto& pairs : chunk_pairs) {
+                result.insert(result.end(), pairs.begin(), pairs.end());
+            }
+            return result;
+        }
+
+    private:
+        static constexpr unsigned radix_bits = 11;
+        static constexpr std::size_t radix_size = std::size_t{1} << radix_bits;
+
+        // Stable least significant digit radix sort of (keys_, indices_) on the
+        // low key_bits bits. Each chunk counts its digits into its own small
+        // histogram and scatters into the ranges an exclusive prefix over
+        // (digit, chunk) reserves for it, so threads never share a write location.
+        void radix_sort(unsigned key_bits, unsigned thread_count)
+        {
+            const auto count = keys_.size();
+            const auto chunks = parallel_chunk_count(count, thread_count);
+            histograms_.resize(chunks * radix_size);
+            scratch_keys_.resize(count);
+            scratch_indices_.resize(count);
+            for (unsigned shift = 0; shift < key_bits; shift += radix_bits) {
+                std::fill(histograms_.begin(), histograms_.end(), 0);
+                parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+                    auto* histogram = &histograms_[chunk * radix_size];
+                    for (std::size_t i = begin; i < end; ++i) {
+                        ++histogram[(keys_[i] >> shift) & (radix_size - 1)];
+                    }
+                });
+
+                std::uint32_t offset = 0;
+                for (std::size_t digit = 0; digit < radix_size; ++digit) {
+                    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                        const auto amount = histograms_[chunk * radix_size + digit];
+                        histograms_[chunk * radix_size + digit] = offset;
+                        offset += amount;
+                    }
+                }
+
+                parallel_for(count, thread_count, [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+                    auto* cursor = &histograms_[chunk * radix_size];
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const auto slot = cursor[(keys_[i] >> shift) & (radix_size - 1)]++;
+                        scratch_keys_[slot] = keys_[i];
+                        scratch_indices_[slot] = indices_[i];
+                    }
+                });
+                keys_.swap(scratch_keys_);
+                indices_.swap(scratch_indices_);
+            }
+        }
+
+        [[nodiscard]] std::uint32_t bucket_of(const Vector3_i& cell) const noexcept
+        {
+            // Large primes from Teschner et al., "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+            const auto hash = (static_cast<std::uint32_t>(cell[0]) * 73856093U) ^
+                              (static_cast<std::uint32_t>(cell[1]) * 19349663U) ^
+                              (static_cast<std::uint32_t>(cell[2]) * 83492791U);
+            return hash & mask_;
+        }
+
+        // Visits the sorted slot of every point stored in a cell overlapping [min, max]
+        template<typename Function>
+        void for_each_candidate(const Vector3_t<T>& min, const Vector3_t<T>& max, Function&& function) const
+        {
+            if (indices_.empty()) {
+                return;
+            }
+            const auto first = cell_of(min);
+            const auto last = cell_of(max);
+            for (auto z = first[2]; z <= last[2]; ++z) {
+                for (auto y = first[1]; y <= last[1]; ++y) {
+                    for (auto x = first[0]; x <= last[0]; ++x) {
+                        const Vector3_i cell{x, y, z};
+                        const auto bucket = bucket_of(cell);
+                        for (auto slot = bucket_starts_[bucket]; slot < bucket_starts_[bucket + 1]; ++slot) {
+                            if (cell_of(positions_[slot]) == cell) {
+                                function(slot);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        T cell_size_;
+        T inverse_cell_size_;
+        std::size_t requested_buckets_;
+        std::uint32_t mask_ = 0;
+        std::vector<std::uint32_t> bucket_starts_;
+        std::vector<std::uint32_t> indices_;
+        // Copies of the positions in bucket order, so a bucket is one contiguous read
+        std::vector<Vector3_t<T>> positions_;
+        // Build scratch: bucket keys in slot order and the radix sort buffers
+        std::vector<std::uint32_t> keys_;
+        std::vector<std::uint32_t> scratch_keys_;
+        std::vector<std::uint32_t> scratch_indices_;
+        std::vector<std::uint32_t> histograms_;
+    };
+} // namespace orion::math
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "abs.h"
+#include "instrument.h" // ORION_MATH_COUNT
 
+#include <bit> // std::bit_width
 #include <concepts>
 #include <limits>
+#include <type_traits> // std::make_unsigned_t, std::is_signed_v
 
 namespace orion::math
 {
@@ -11,6 +14,7 @@ namespace orion::math
     [[nodiscard]] constexpr Floating sqrt(Floating value) noexcept
     {
         // TODO: Add precondition for negative values
+        ORION_MATH_COUNT(sqrt);
 
         if (value == Floating{0}) {
             return Floating{0};
@@ -18,6 +22,7 @@ namespace orion::math
 
         auto result = value / 2;
         while (true) {
+            ORION_MATH_COUNT(sqrt_iteration);
             auto next = Floating{0.5} * (result + value / result);
             auto diff = abs(result - next);
             if (diff <= std::numeric_limits<Floating>::epsilon()) {
@@ -33,4 +38,32 @@ namespace orion::math
     {
         return sqrt(static_cast<double>(value));
     }
+
+    // Integer square root rounded down, computed without leaving the integers.
+    // Negative values give 0.
+    template<std::integral Integral>
+    [[nodiscard]] constexpr Integral isqrt(Integral value) noexcept
+    {
+        if constexpr (std::is_signed_v<Integral>) {
+            if (value < 0) {
+                return 0;
+            }
+        }
+
+        using Unsigned = std::make_unsigned_t<Integral>;
+        const auto number = static_cast<Unsigned>(value);
+        if (number < 2) {
+            return value;
+        }
+
+        // Start above the root and let Newton's method descend onto it
+        auto result = static_cast<Unsigned>(Unsigned{1} << ((std::bit_width(number) + 1) / 2));
+        while (true) {
+            const auto next = static_cast<Unsigned>((result + number / result) / 2);
+            if (next >= result) {
+                return static_cast<Integral>(result);
+            }
+            result = next;
+        }
+    }
 } // namespace orion::math
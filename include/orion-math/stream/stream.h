@@ -0,0 +1,348 @@
+#pragma once
+
+#include "orion-math/matrix/matrix4.h"
+#include "orion-math/matrix/transformation.h" // transform_point
+#include "orion-math/parallel.h"              // parallel_for
+#include "orion-math/reduce/reduce.h"         // Bounds
+#include "orion-math/vector/vector3.h"
+
+#include <array>       // std::array
+#include <cmath>       // std::round
+#include <concepts>    // std::convertible_to
+#include <cstddef>     // std::byte, std::size_t
+#include <cstdio>      // std::FILE, std::fopen, std::fclose, std::fread, std::fwrite, std::ferror
+#include <filesystem>  // std::filesystem::path
+#include <functional>  // std::function, std::ref
+#include <future>      // std::async, std::future
+#include <span>        // std::span, std::as_bytes, std::as_writable_bytes
+#include <stdexcept>   // std::invalid_argument, std::runtime_error
+#include <type_traits> // std::type_identity_t
+#include <utility>     // std::exchange
+#include <vector>      // std::vector
+
+#if __has_include(<unistd.h>)
+    #include <cerrno>       // errno, EINTR
+    #include <system_error> // std::system_error, std::generic_category
+    #include <unistd.h>     // read, write
+#endif
+
+namespace orion::math
+{
+    // Byte streams the point pipeline reads from and writes to. read fills as much
+    // of the buffer as it can and returns the number of bytes, 0 once the input
+    // is exhausted; write consumes the whole buffer. Both report errors by throwing.
+    template<typename Source>
+    concept ByteSource = requires(Source& source, std::span<std::byte> buffer) {
+        { source.read(buffer) } -> std::convertible_to<std::size_t>;
+    };
+
+    template<typename Sink>
+    concept ByteSink = requires(Sink& sink, std::span<const std::byte> buffer) { sink.write(buffer); };
+
+    namespace detail
+    {
+        // Closes the file only when it was opened from a path
+        class StdioFile
+        {
+        public:
+            StdioFile(const std::filesystem::path& path, const char* mode)
+                : file_(std::fopen(path.string().c_str(), mode))
+                , owned_(true)
+            {
+                if (file_ == nullptr) {
+                    throw std::runtime_error("cannot open " + path.string());
+                }
+            }
+
+            explicit StdioFile(std::FILE* file)
+                : file_(file)
+            {
+                if (file_ == nullptr) {
+                    throw std::invalid_argument("file must not be null");
+                }
+            }
+
+            StdioFile(const StdioFile&) = delete;
+            StdioFile& operator=(const StdioFile&) = delete;
+
+            StdioFile(StdioFile&& other) noexcept
+                : file_(std::exchange(other.file_, nullptr))
+                , owned_(std::exchange(other.owned_, false))
+            {
+            }
+
+            StdioFile& operator=(StdioFile&& other) noexcept
+            {
+                if (this != &other) {
+                    close();
+                    file_ = std::exchange(other.file_, nullptr);
+                    owned_ = std::exchange(other.owned_, false);
+                }
+                return *this;
+            }
+
+            ~StdioFile() { close(); }
+
+            [[nodiscard]] std::FILE* get() const noexcept { return file_; }
+
+        private:
+            void close() noexcept
+            {
+                if (owned_ && file_ != nullptr) {
+                    std::fclose(file_);
+                }
+            }
+
+            std::FILE* file_;
+            bool owned_ = false;
+        };
+    } // namespace detail
+
+    // Reads from a C stream, either opened from a path and closed on destruction
+    // or borrowed from the caller
+    class FileSource
+    {
+    public:
+        explicit FileSource(const std::filesystem::path& path)
+            : file_(path, "rb")
+        {
+        }
+
+        explicit FileSource(std::FILE* file)
+            : file_(file)
+        {
+        }
+
+        [[nodiscard]] std::size_t read(std::span<std::byte> buffer)
+        {
+            const auto count = std::fread(buffer.data(), 1, buffer.size(), file_.get());
+            if (count < buffer.size() && std::ferror(file_.get()) != 0) {
+                throw std::runtime_error("reading from file failed");
+            }
+            return count;
+        }
+
+    private:
+        detail::StdioFile file_;
+    };
+
+    // Writes to a C stream, either created from a path and closed on destruction
+    // or borrowed from the caller
+    class FileSink
+    {
+    public:
+        explicit FileSink(const std::filesystem::path& path)
+            : file_(path, "wb")
+        {
+        }
+
+        explicit FileSink(std::FILE* file)
+            : file_(file)
+        {
+        }
+
+        void write(std::span<const std::byte> buffer)
+        {
+            if (std::fwrite(buffer.data(), 1, buffer.size(), file_.get()) != buffer.size()) {
+                throw std::runtime_error("writing to file failed");
+            }
+        }
+
+    private:
+        detail::StdioFile file_;
+    };
+
+#if __has_include(<unistd.h>)
+    // Reads from a POSIX file descriptor owned by the caller, such as a pipe or socket
+    class DescriptorSource
+    {
+    public:
+        explicit DescriptorSource(int descriptor) noexcept
+            : descriptor_(descriptor)
+        {
+        }
+
+        [[nodiscard]] std::size_t read(std::span<std::byte> buffer)
+        {
+            while (true) {
+                const auto count = ::read(descriptor_, buffer.data(), buffer.size());
+                if (count >= 0) {
+                    return static_cast<std::size_t>(count);
+                }
+                if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "reading from descriptor failed");
+                }
+            }
+        }
+
+    private:
+        int descriptor_;
+    };
+
+    // Writes to a POSIX file descriptor owned by the caller
+    class DescriptorSink
+    {
+    public:
+        explicit DescriptorSink(int descriptor) noexcept
+            : descriptor_(descriptor)
+        {
+        }
+
+        void write(std::span<const std::byte> buffer)
+        {
+            while (!buffer.empty()) {
+                const auto count = ::write(descriptor_, buffer.data(), buffer.size());
+                if (count >= 0) {
+                    buffer = buffer.subspan(static_cast<std::size_t>(count));
+                } else if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "writing to descriptor failed");
+                }
+            }
+        }
+
+    private:
+        int descriptor_;
+    };
+#endif
+
+    // One step of a point pipeline. Rewrites the chunk in place and returns how
+    // many points at its front survive; the thread count is the one the pipeline runs with.
+    template<typename T>
+    using PointStage = std::function<std::size_t(std::span<Vector3_t<T>> points, unsigned thread_count)>;
+
+    // points[i] = transform_point(points[i], matrix)
+    template<typename T = float>
+    [[nodiscard]] PointStage<T> transform_stage(const std::type_identity_t<Matrix4_t<T>>& matrix)
+    {
+        return [matrix](std::span<Vector3_t<T>> points, unsigned thread_count) {
+            parallel_for(points.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    points[i] = transform_point(points[i], matrix);
+                }
+            });
+            return points.size();
+        };
+    }
+
+    // Keeps the points inside bounds, boundary included, in their original order
+    template<typename T = float>
+    [[nodiscard]] PointStage<T> filter_stage(const std::type_identity_t<Bounds<T, 3>>& bounds)
+    {
+        return [bounds](std::span<Vector3_t<T>> points, unsigned) {
+            std::size_t kept = 0;
+            for (const auto& point : points) {
+                const auto inside = point[0] >= bounds.min[0] && point[0] <= bounds.max[0] &&
+                                    point[1] >= bounds.min[1] && point[1] <= bounds.max[1] &&
+                                    point[2] >= bounds.min[2] && point[2] <= bounds.max[2];
+                if (inside) {
+                    points[kept++] = point;
+                }
+            }
+            return kept;
+        };
+    }
+
+    // Snaps every point to the nearest node of the grid through origin with
+    // spacing step per axis. Throws std::invalid_argument unless every step is positive.
+    template<typename T = float>
+    [[nodiscard]] PointStage<T> quantize_stage(const std::type_identity_t<Vector3_t<T>>& origin, const std::type_identity_t<Vector3_t<T>>& step)
+    {
+        if (!(step[0] > 0 && step[1] > 0 && step[2] > 0)) {
+            throw std::invalid_argument("quantization step must be positive");
+        }
+        return [origin, step](std::span<Vector3_t<T>> points, unsigned thread_count) {
+            parallel_for(points.size(), thread_count, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    for (std::size_t axis = 0; axis < 3; ++axis) {
+                        points[i][axis] = origin[axis] + std::round((points[i][axis] - origin[axis]) / step[axis]) * step[axis];
+                    }
+                }
+            });
+            return points.size();
+        };
+    }
+
+    struct StreamSettings {
+        // Points per chunk. Two chunks are resident at a time, one being read
+        // while the other runs through the stages.
+        std::size_t chunk_size = 1 << 16;
+        // Threads each stage splits a chunk across
+        unsigned thread_count = 1;
+    };
+
+    struct StreamResult {
+        std::size_t chunks;
+        std::size_t points_read;
+        std::size_t points_written;
+    };
+
+    namespace detail
+    {
+        // Fills buffer unless the source runs dry first and returns the number of
+        // whole points read. Throws std::runtime_error on a trailing partial point.
+        template<typename T, ByteSource Source>
+        [[nodiscard]] std::size_t read_chunk(Source& source, std::span<Vector3_t<T>> buffer)
+        {
+            static_assert(sizeof(Vector3_t<T>) == 3 * sizeof(T), "point records must be tightly packed");
+            const auto bytes = std::as_writable_bytes(buffer);
+            std::size_t filled = 0;
+            while (filled < bytes.size()) {
+                const std::size_t count = source.read(bytes.subspan(filled));
+                if (count == 0) {
+                    break;
+                }
+                filled += count;
+            }
+            if (filled % sizeof(Vector3_t<T>) != 0) {
+                throw std::runtime_error("input ends inside a point record");
+            }
+            return filled / sizeof(Vector3_t<T>);
+        }
+    } // namespace detail
+
+    // Streams raw native-endian Vector3_t<T> records from source to sink through
+    // stages, applied in order to one chunk at a time. The next chunk is read on a
+    // separate thread while the current one is processed and written, so input of
+    // any length runs in memory for two chunks. Exceptions from the source,
+    // the stages or the sink stop the stream and propagate to the caller.
+    template<typename T = float, ByteSource Source, ByteSink Sink>
+    StreamResult stream_points(Source& source, Sink& sink, std::type_identity_t<std::span<const PointStage<T>>> stages, const StreamSettings& settings = {})
+    {
+        if (settings.chunk_size == 0) {
+            throw std::invalid_argument("chunk size must not be zero");
+        }
+
+        std::array<std::vector<Vector3_t<T>>, 2> buffers{std::vector<Vector3_t<T>>(settings.chunk_size), std::vector<Vector3_t<T>>(settings.chunk_size)};
+        auto read_into = [&source](std::vector<Vector3_t<T>>& buffer) { return detail::read_chunk<T>(source, std::span{buffer}); };
+
+        StreamResult result{0, 0, 0};
+        // Declared after the buffers so a read still in flight when an exception
+        // unwinds is waited for before the buffer it fills goes away
+        auto pending = std::async(std::launch::async, read_into, std::ref(buffers[0]));
+        for (std::size_t current = 0;; current ^= 1) {
+            const auto count = pending.get();
+            if (count == 0) {
+                break;
+            }
+            // A short chunk means the source is exhausted, there is nothing to prefetch
+            const auto last = count < settings.chunk_size;
+            if (!last) {
+                pending = std::async(std::launch::async, read_into, std::ref(buffers[current ^ 1]));
+            }
+
+            auto points = std::span{buffers[current]}.first(count);
+            for (const auto& stage : stages) {
+                points = points.first(stage(points, settings.thread_count));
+            }
+            sink.write(std::as_bytes(points));
+
+            ++result.chunks;
+            result.points_read += count;
+            result.points_written += points.size();
+            if (last) {
+                break;
+            }
+        }
+        return result;
+    }
+} // namespace orion::math
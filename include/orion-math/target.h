@@ -0,0 +1,28 @@
+#pragma once
+
+// Instruction sets the target is compiled for. Kept apart from simd.h so
+// headers that only branch on a feature do not pull in the intrinsics headers.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ORION_MATH_SSE2 1
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+    #define ORION_MATH_SSE41 1
+#endif
+
+#if defined(__AVX__)
+    #define ORION_MATH_AVX 1
+#endif
+
+#if defined(__AVX2__)
+    #define ORION_MATH_AVX2 1
+#endif
+
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+    #define ORION_MATH_FMA 1
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+    #define ORION_MATH_F16C 1
+#endif
@@ -2,6 +2,7 @@
 
 #include "angles.h"
 #include "constants.h"
+#include "instrument.h" // ORION_MATH_COUNT
 
 #include <cmath> // runtime implementations
 
@@ -96,6 +97,7 @@ namespace orion::math
     template<std::floating_point Return = double>
     [[nodiscard]] constexpr Return sin(Radians radians) noexcept
     {
+        ORION_MATH_COUNT(sin);
         if (std::is_constant_evaluated()) {
             return detail::sin_taylor_series<Return>(radians);
         }
@@ -105,6 +107,7 @@ namespace orion::math
     template<std::floating_point Return = double>
     [[nodiscard]] constexpr Return cos(Radians radians) noexcept
     {
+        ORION_MATH_COUNT(cos);
         if (std::is_constant_evaluated()) {
             return detail::cos_taylor_series<Return>(radians);
         }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "orion-math/half.h"
 #include "vector.h"
 
 #include <fmt/format.h>
@@ -12,6 +13,15 @@ template<typename T, std::size_t N>
 struct fmt::is_range<orion::math::Vector<T, N>, char> : std::false_type {
 };
 
+template<>
+struct fmt::formatter<orion::math::half> : fmt::formatter<float> {
+    template<typename FormatContext>
+    auto format(orion::math::half value, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        return fmt::formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
 template<typename T, std::size_t N>
 struct fmt::formatter<orion::math::Vector<T, N>> {
     constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) { return ctx.begin(); }
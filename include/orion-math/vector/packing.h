@@ -0,0 +1,304 @@
+#pragma once
+
+#include "orion-math/half.h"       // half
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+#include "orion-math/target.h"     // ORION_MATH_F16C
+#include "vector.h"
+#include "vector2.h"
+#include "vector3.h"
+#include "vector4.h"
+
+#include <algorithm>   // std::clamp, std::max, std::ranges::transform
+#include <cmath>       // std::abs, std::isnan, std::round, std::sqrt
+#include <concepts>    // std::integral, std::signed_integral, std::unsigned_integral
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int16_t, std::uint16_t, std::uint64_t
+#include <limits>      // std::numeric_limits
+#include <span>        // std::span
+#include <stdexcept>   // std::invalid_argument
+
+#if defined(ORION_MATH_F16C)
+    #include <immintrin.h> // _mm256_cvtps_ph, _mm256_cvtph_ps
+#endif
+
+namespace orion::math
+{
+    using Vector2_h = Vector2_t<half>;
+    using Vector3_h = Vector3_t<half>;
+    using Vector4_h = Vector4_t<half>;
+
+    namespace detail
+    {
+        inline void check_packing_sizes(std::size_t from, std::size_t to)
+        {
+            if (from != to) {
+                throw std::invalid_argument("packing spans must have the same size");
+            }
+        }
+
+        inline void floats_to_halves(const float* from, half* to, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#if defined(ORION_MATH_F16C)
+            for (; i + 8 <= count; i += 8) {
+                const auto halves = _mm256_cvtps_ph(_mm256_loadu_ps(from + i), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), halves); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+#endif
+            for (; i < count; ++i) {
+                to[i] = half{from[i]};
+            }
+        }
+
+        inline void halves_to_floats(const half* from, float* to, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+#if defined(ORION_MATH_F16C)
+            for (; i + 8 <= count; i += 8) {
+                const auto halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_storeu_ps(to + i, _mm256_cvtph_ps(halves));
+            }
+#endif
+            for (; i < count; ++i) {
+                to[i] = static_cast<float>(from[i]);
+            }
+        }
+
+        template<std::integral Int>
+        [[nodiscard]] inline Int quantize_unorm(float value) noexcept
+        {
+            constexpr auto max = static_cast<float>(std::numeric_limits<Int>::max());
+            // NaN passes through clamp and casting it is undefined, it packs as 0
+            if (std::isnan(value)) {
+                return 0;
+            }
+            return static_cast<Int>(std::round(std::clamp(value, 0.f, 1.f) * max));
+        }
+
+        template<std::integral Int>
+        [[nodiscard]] inline Int quantize_snorm(float value) noexcept
+        {
+            constexpr auto max = static_cast<float>(std::numeric_limits<Int>::max());
+            if (std::isnan(value)) {
+                return 0;
+            }
+            return static_cast<Int>(std::round(std::clamp(value, -1.f, 1.f) * max));
+        }
+    } // namespace detail
+
+    // Unit normal packed into two 16 bit snorm components
+    using OctahedralNormal = Vector2_t<std::int16_t>;
+
+    // Unit quaternion packed into 48 bits, see pack_quaternion
+    using PackedQuaternion = Vector3_t<std::uint16_t>;
+
+    template<std::size_t N>
+    [[nodiscard]] constexpr Vector<half, N> pack_half(const Vector<float, N>& vector) noexcept
+    {
+        Vector<half, N> result;
+        std::ranges::transform(vector, result.begin(), [](float component) { return half{component}; });
+        return result;
+    }
+
+    template<std::size_t N>
+    [[nodiscard]] constexpr Vector<float, N> unpack_half(const Vector<half, N>& vector) noexcept
+    {
+        return vector_cast<float>(vector);
+    }
+
+    // Bulk conversions operate on the flattened components and use F16C when
+    // the target enables it. Empty spans may have no storage to flatten, so
+    // they return before taking the component pointers.
+    inline void pack_half(std::span<const Vector3_f> from, std::span<Vector3_h> to)
+    {
+        detail::check_packing_sizes(from.size(), to.size());
+        ORION_MATH_INSTRUMENT_BATCH(from.size());
+        if (from.empty()) {
+            return;
+        }
+        detail::floats_to_halves(from.data()->data(), to.data()->data(), from.size() * 3);
+    }
+
+    inline void pack_half(std::span<const Vector4_f> from, std::span<Vector4_h> to)
+    {
+        detail::check_packing_sizes(from.size(), to.size());
+        ORION_MATH_INSTRUMENT_BATCH(from.size());
+        if (from.empty()) {
+            return;
+        }
+        detail::floats_to_halves(from.data()->data(), to.data()->data(), from.size() * 4);
+    }
+
+    inline void unpack_half(std::span<const Vector3_h> from, std::span<Vector3_f> to)
+    {
+        detail::check_packing_sizes(from.size(), to.size());
+        ORION_MATH_INSTRUMENT_BATCH(from.size());
+        if (from.empty()) {
+            return;
+        }
+        detail::halves_to_floats(from.data()->data(), to.data()->data(), from.size() * 3);
+    }
+
+    inline void unpack_half(std::span<const Vector4_h> from, std::span<Vector4_f> to)
+    {
+        detail::check_packing_sizes(from.size(), to.size());
+        ORION_MATH_INSTRUMENT_BATCH(from.size());
+        if (from.empty()) {
+            return;
+        }
+        detail::halves_to_floats(from.data()->data(), to.data()->data(), from.size() * 4);
+    }
+
+    // Maps [0, 1] onto [0, max] of an unsigned integer type
+    template<std::unsigned_integral Int, std::size_t N>
+    [[nodiscard]] Vector<Int, N> pack_unorm(const Vector<float, N>& vector) noexcept
+    {
+        Vector<Int, N> result;
+        std::ranges::transform(vector, result.begin(), detail::quantize_unorm<Int>);
+        return result;
+    }
+
+    template<std::unsigned_integral Int, std::size_t N>
+    [[nodiscard]] constexpr Vector<float, N> unpack_unorm(const Vector<Int, N>& vector) noexcept
+    {
+        constexpr auto max = static_cast<float>(std::numeric_limits<Int>::max());
+        Vector<float, N> result;
+        std::ranges::transform(vector, result.begin(), [](Int component) { return static_cast<float>(component) / max; });
+        return result;
+    }
+
+    // Maps [-1, 1] onto [-max, max] of a signed integer type, the most negative
+    // value decodes to -1 as well
+    template<std::signed_integral Int, std::size_t N>
+    [[nodiscard]] Vector<Int, N> pack_snorm(const Vector<float, N>& vector) noexcept
+    {
+        Vector<Int, N> result;
+        std::ranges::transform(vector, result.begin(), detail::quantize_snorm<Int>);
+        return result;
+    }
+
+    template<std::signed_integral Int, std::size_t N>
+    [[nodiscard]] constexpr Vector<float, N> unpack_snorm(const Vector<Int, N>& vector) noexcept
+    {
+        constexpr auto max = static_cast<float>(std::numeric_limits<Int>::max());
+        Vector<float, N> result;
+        std::ranges::transform(vector, result.begin(), [](Int component) { return std::max(static_cast<float>(component) / max, -1.f); });
+        return result;
+    }
+
+    // Octahedral encoding of a unit vector. The sphere is projected onto the
+    // octahedron |x| + |y| + |z| = 1 and the lower half is folded over the upper one.
+    // A zero vector, as left by degenerate faces, encodes as (0, 0) and decodes to +z.
+    [[nodiscard]] inline Vector2_f encode_octahedral_f(const Vector3_f& normal) noexcept
+    {
+        const auto l1 = std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z());
+        if (l1 == 0.f) {
+            return {0.f, 0.f};
+        }
+        const auto inverse_l1 = 1.f / l1;
+        auto x = normal.x() * inverse_l1;
+        auto y = normal.y() * inverse_l1;
+        if (normal.z() < 0.f) {
+            const auto folded_x = (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f);
+            const auto folded_y = (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f);
+            x = folded_x;
+            y = folded_y;
+        }
+        return {x, y};
+    }
+
+    [[nodiscard]] inline Vector3_f decode_octahedral_f(const Vector2_f& encoded) noexcept
+    {
+        auto x = encoded.x();
+        auto y = encoded.y();
+        const auto z = 1.f - std::abs(x) - std::abs(y);
+        const auto fold = std::max(-z, 0.f);
+        x += x >= 0.f ? -fold : fold;
+        y += y >= 0.f ? -fold : fold;
+        return Vector3_f{x, y, z} / std::sqrt(x * x + y * y + z * z);
+    }
+
+    [[nodiscard]] inline OctahedralNormal encode_octahedral(const Vector3_f& normal) noexcept
+    {
+        return pack_snorm<std::int16_t>(encode_octahedral_f(normal));
+    }
+
+    [[nodiscard]] inline Vector3_f decode_octahedral(const OctahedralNormal& encoded) noexcept
+    {
+        return decode_octahedral_f(unpack_snorm(encoded));
+    }
+
+    inline void encode_octahedral(std::span<const Vector3_f> normals, std::span<OctahedralNormal> encoded)
+    {
+        detail::check_packing_sizes(normals.size(), encoded.size());
+        ORION_MATH_INSTRUMENT_BATCH(normals.size());
+        for (std::size_t i = 0; i < normals.size(); ++i) {
+            encoded[i] = encode_octahedral(normals[i]);
+        }
+    }
+
+    inline void decode_octahedral(std::span<const OctahedralNormal> encoded, std::span<Vector3_f> normals)
+    {
+        detail::check_packing_sizes(encoded.size(), normals.size());
+        ORION_MATH_INSTRUMENT_BATCH(encoded.size());
+        for (std::size_t i = 0; i < encoded.size(); ++i) {
+            normals[i] = decode_octahedral(encoded[i]);
+        }
+    }
+
+    // Smallest three encoding: the largest component of a unit quaternion is
+    // dropped and rebuilt from unit length on decode. It is made positive first,
+    // q and -q being the same rotation, which bounds the remaining three to
+    // [-1/sqrt(2), 1/sqrt(2)]. Bits 0-1 hold the dropped index, then three
+    // 15 bit fields hold the other components in order, giving a worst case
+    // rotation error of about 1e-4 radians.
+    [[nodiscard]] inline PackedQuaternion pack_quaternion(Vector4_f quaternion) noexcept
+    {
+        constexpr auto range = 0.70710678f;
+        constexpr auto max = 32767.f;
+
+        // NaN passes through clamp and casting it is undefined, and it would win
+        // the search for the largest component, so it packs as 0
+        for (std::size_t i = 0; i < 4; ++i) {
+            if (std::isnan(quaternion[i])) {
+                quaternion[i] = 0.f;
+            }
+        }
+        std::size_t largest = 0;
+        for (std::size_t i = 1; i < 4; ++i) {
+            largest = std::abs(quaternion[i]) > std::abs(quaternion[largest]) ? i : largest;
+        }
+        const auto sign = quaternion[largest] < 0.f ? -1.f : 1.f;
+
+        std::uint64_t bits = largest;
+        for (std::size_t i = 0, field = 0; i < 4; ++i) {
+            if (i == largest) {
+                continue;
+            }
+            const auto normalized = std::clamp(quaternion[i] * sign / range, -1.f, 1.f) * .5f + .5f;
+            bits |= static_cast<std::uint64_t>(std::round(normalized * max)) << (2 + 15 * field++);
+        }
+        return {static_cast<std::uint16_t>(bits), static_cast<std::uint16_t>(bits >> 16), static_cast<std::uint16_t>(bits >> 32)};
+    }
+
+    [[nodiscard]] inline Vector4_f unpack_quaternion(const PackedQuaternion& packed) noexcept
+    {
+        constexpr auto range = 0.70710678f;
+        constexpr auto max = 32767.f;
+
+        const auto bits = static_cast<std::uint64_t>(packed[0]) | (static_cast<std::uint64_t>(packed[1]) << 16) | (static_cast<std::uint64_t>(packed[2]) << 32);
+        const auto largest = static_cast<std::size_t>(bits & 3U);
+        Vector4_f result;
+        float sqr_sum = 0.f;
+        for (std::size_t i = 0, field = 0; i < 4; ++i) {
+            if (i == largest) {
+                continue;
+            }
+            const auto quantized = static_cast<float>((bits >> (2 + 15 * field++)) & 0x7fffU);
+            result[i] = (quantized / max * 2.f - 1.f) * range;
+            sqr_sum += result[i] * result[i];
+        }
+        result[largest] = std::sqrt(std::max(0.f, 1.f - sqr_sum));
+        return result;
+    }
+} // namespace orion::math
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "orion-math/angles.h"
+#include "orion-math/fma.h" // fmadd
+#include "orion-math/trig.h"
+#include "vector3.h"
+#include "vector4.h"
+
+#include <cmath>       // std::acos, std::sin, std::sqrt
+#include <type_traits> // std::type_identity_t
+
+namespace orion::math
+{
+    // Rotation quaternions are stored as Vector4 in (x, y, z, w) order, w being the scalar part
+    template<typename T>
+    using Quaternion_t = Vector4_t<T>;
+
+    using Quaternion_f = Quaternion_t<float>;
+    using Quaternion_d = Quaternion_t<double>;
+    using Quaternion = Quaternion_f;
+
+    template<typename T = float>
+    [[nodiscard]] constexpr Quaternion_t<T> quaternion_identity() noexcept
+    {
+        return {T{0}, T{0}, T{0}, T{1}};
+    }
+
+    // Rotation of radians around a unit axis, counter-clockwise when looking down the axis
+    template<typename T>
+    [[nodiscard]] constexpr Quaternion_t<T> quaternion_from_axis_angle(const Vector3_t<T>& axis, Radians radians) noexcept
+    {
+        const auto half_sin = sin<T>(radians / 2);
+        const auto half_cos = cos<T>(radians / 2);
+        return {axis.x() * half_sin, axis.y() * half_sin, axis.z() * half_sin, half_cos};
+    }
+
+    // Hamilton product. Rotating by quaternion_multiply(lhs, rhs) rotates by rhs first, then by lhs.
+    template<typename T>
+    [[nodiscard]] constexpr Quaternion_t<T> quaternion_multiply(const Quaternion_t<T>& lhs, const Quaternion_t<T>& rhs) noexcept
+    {
+        return {
+            fmadd(lhs.w(), rhs.x(), fmadd(lhs.x(), rhs.w(), fmadd(lhs.y(), rhs.z(), -lhs.z() * rhs.y()))),
+            fmadd(lhs.w(), rhs.y(), fmadd(lhs.y(), rhs.w(), fmadd(lhs.z(), rhs.x(), -lhs.x() * rhs.z()))),
+            fmadd(lhs.w(), rhs.z(), fmadd(lhs.z(), rhs.w(), fmadd(lhs.x(), rhs.y(), -lhs.y() * rhs.x()))),
+            fmadd(lhs.w(), rhs.w(), -fmadd(lhs.x(), rhs.x(), fmadd(lhs.y(), rhs.y(), lhs.z() * rhs.z())))};
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr Quaternion_t<T> quaternion_conjugate(const Quaternion_t<T>& quaternion) noexcept
+    {
+        return {-quaternion.x(), -quaternion.y(), -quaternion.z(), quaternion.w()};
+    }
+
+    // Rotates a vector by a unit quaternion using v' = v + 2w(q x v) + 2(q x (q x v))
+    template<typename T>
+    [[nodiscard]] constexpr Vector3_t<T> quaternion_rotate(const Quaternion_t<T>& quaternion, const Vector3_t<T>& vector) noexcept
+    {
+        const Vector3_t<T> axis{quaternion.x(), quaternion.y(), quaternion.z()};
+        const auto twice_cross = cross(axis, vector) * T{2};
+        return vector + twice_cross * quaternion.w() + cross(axis, twice_cross);
+    }
+
+    // Linear interpolation along the shortest arc, renormalized. Cheaper than
+    // slerp but the angular velocity is not constant; the error stays small for
+    // the nearby rotations that animation blending usually sees.
+    template<typename T>
+    [[nodiscard]] Quaternion_t<T> nlerp(const Quaternion_t<T>& from, const Quaternion_t<T>& to, std::type_identity_t<T> t) noexcept
+    {
+        const auto target = dot(from, to) < T{0} ? -to : to;
+        const auto rotation = lerp(from, target, t);
+        return rotation / std::sqrt(rotation.sqr_magnitude());
+    }
+
+    // Spherical linear interpolation along the shortest arc at constant
+    // angular velocity. Falls back to nlerp when the rotations are too close
+    // for sin(angle) to be divided by safely.
+    template<typename T>
+    [[nodiscard]] Quaternion_t<T> slerp(const Quaternion_t<T>& from, const Quaternion_t<T>& to, std::type_identity_t<T> t) noexcept
+    {
+        auto cos_angle = dot(from, to);
+        const auto target = cos_angle < T{0} ? -to : to;
+        cos_angle = cos_angle < T{0} ? -cos_angle : cos_angle;
+        if (cos_angle > static_cast<T>(.9995)) {
+            return nlerp(from, target, t);
+        }
+        const auto angle = std::acos(cos_angle);
+        const auto inverse_sin = T{1} / std::sin(angle);
+        return from * (std::sin((T{1} - t) * angle) * inverse_sin) + target * (std::sin(t * angle) * inverse_sin);
+    }
+} // namespace orion::math
@@ -1,18 +1,20 @@
 #pragma once
 
-#include "orion-math/concepts.h" // arithmetic
-#include "orion-math/func.h"     // negate, plus, minus
-#include "orion-math/sqrt.h"     // orion::math::sqrt
+#include "orion-math/concepts.h"   // arithmetic
+#include "orion-math/fma.h"        // fmadd, difference_of_products
+#include "orion-math/func.h"       // negate, plus, minus
+#include "orion-math/instrument.h" // ORION_MATH_COUNT
+#include "orion-math/sqrt.h"       // orion::math::sqrt, orion::math::isqrt
 
 #include <algorithm>   // std::ranges::transform, std::ranges::for_each, std::accumulate
 #include <array>       // std::array
-#include <concepts>    // std::floating_point
+#include <concepts>    // std::floating_point, std::signed_integral, std::unsigned_integral
 #include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::int64_t, std::uint64_t
 #include <iterator>    // std::prev
-#include <numeric>     // std::transform_reduce, std::inner_product
 #include <ranges>      // std::ranges::input_range, std::ranges::begin, std::ranges::end
 #include <stdexcept>   // std::out_of_range
-#include <type_traits> // std::common_type, std::is_same_v
+#include <type_traits> // std::common_type, std::is_same_v, std::type_identity_t
 
 #define ORION_VECTOR_DEFINE_COMPONENT(name, index)                \
     [[nodiscard]] constexpr reference name() noexcept             \
@@ -28,6 +30,45 @@
 
 namespace orion::math
 {
+    namespace detail
+    {
+        // Integer products are accumulated in 64 bits. Each product of 32 bit
+        // components fits, the sum is exact while it stays in range: components
+        // within +-2^30 for up to four dimensions when signed, below 2^31 when
+        // unsigned. Narrower components never overflow.
+        template<typename T>
+        struct widened {
+            using type = T;
+        };
+
+        template<std::signed_integral T>
+            requires(sizeof(T) < sizeof(std::int64_t))
+        struct widened<T> {
+            using type = std::int64_t;
+        };
+
+        template<std::unsigned_integral T>
+            requires(sizeof(T) < sizeof(std::uint64_t))
+        struct widened<T> {
+            using type = std::uint64_t;
+        };
+
+        template<typename T>
+        using widened_t = typename widened<T>::type;
+
+        // Accumulates lhs[i] * rhs[i] front to back with one fused multiply-add per component
+        template<typename T, std::size_t N>
+        [[nodiscard]] constexpr widened_t<T> fused_dot(const std::array<T, N>& lhs, const std::array<T, N>& rhs) noexcept
+        {
+            using accumulator = widened_t<T>;
+            accumulator result{};
+            for (std::size_t i = 0; i < N; ++i) {
+                result = fmadd(static_cast<accumulator>(lhs[i]), static_cast<accumulator>(rhs[i]), result);
+            }
+            return result;
+        }
+    } // namespace detail
+
     template<arithmetic T, std::size_t N>
     struct Vector {
     public:
@@ -74,7 +115,7 @@ namespace orion::math
 
         [[nodiscard]] constexpr auto sqr_magnitude() const noexcept
         {
-            return std::inner_product(begin(), end(), begin(), value_type{});
+            return detail::fused_dot(components_, components_);
         }
 
         [[nodiscard]] constexpr auto magnitude() const noexcept
@@ -82,8 +123,16 @@ namespace orion::math
             return sqrt(sqr_magnitude());
         }
 
+        // Magnitude of an integer vector rounded down, without leaving the integers
+        [[nodiscard]] constexpr auto integer_magnitude() const noexcept
+            requires std::integral<value_type>
+        {
+            return isqrt(sqr_magnitude());
+        }
+
         [[nodiscard]] constexpr auto normalized() const noexcept
         {
+            ORION_MATH_COUNT(normalize);
             return *this / magnitude();
         }
 
@@ -141,21 +190,21 @@ namespace orion::math
 
         [[nodiscard]] friend constexpr Vector operator-(const Vector& vector) noexcept
         {
-            Vector result;
+            Vector result{};
             std::ranges::transform(vector, result.begin(), negate<>{});
             return result;
         }
 
         [[nodiscard]] friend constexpr Vector operator+(const Vector& lhs, const Vector& rhs) noexcept
         {
-            Vector result;
+            Vector result{};
             std::ranges::transform(lhs, rhs, result.begin(), plus<>{});
             return result;
         }
 
         [[nodiscard]] friend constexpr Vector operator-(const Vector& lhs, const Vector& rhs) noexcept
         {
-            Vector result;
+            Vector result{};
             std::ranges::transform(lhs, rhs, result.begin(), minus<>{});
             return result;
         }
@@ -166,17 +215,27 @@ namespace orion::math
     template<typename T, std::size_t N>
     [[nodiscard]] constexpr auto dot(const Vector<T, N>& lhs, const Vector<T, N>& rhs) noexcept
     {
-        using value_type = typename Vector<T, N>::value_type;
-        return std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), value_type{});
+        return detail::fused_dot(lhs.components_, rhs.components_);
     }
 
     template<typename T>
     [[nodiscard]] constexpr Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs) noexcept
     {
         return {
-            lhs[1] * rhs[2] - lhs[2] * rhs[1],
-            lhs[2] * rhs[0] - lhs[0] * rhs[2],
-            lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+            difference_of_products(lhs[1], rhs[2], lhs[2], rhs[1]),
+            difference_of_products(lhs[2], rhs[0], lhs[0], rhs[2]),
+            difference_of_products(lhs[0], rhs[1], lhs[1], rhs[0])};
+    }
+
+    // from + (to - from) * t with one fused multiply-add per component
+    template<std::floating_point T, std::size_t N>
+    [[nodiscard]] constexpr Vector<T, N> lerp(const Vector<T, N>& from, const Vector<T, N>& to, std::type_identity_t<T> t) noexcept
+    {
+        Vector<T, N> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = fmadd(to[i] - from[i], t, from[i]);
+        }
+        return result;
     }
 
     template<typename T, typename T1, std::size_t N1>
@@ -0,0 +1,271 @@
+#pragma once
+
+#include "orion-math/matrix/matrix4.h"
+#include "orion-math/simd.h" // simd::Pack, simd::Mask
+#include "vector.h"
+
+#include <array>     // std::array
+#include <cstddef>   // std::size_t
+#include <span>      // std::span
+#include <stdexcept> // std::invalid_argument
+
+namespace orion::math
+{
+    // Lanes vectors of N components held as N packs, one per component, so code
+    // written against the Vector API runs on Lanes independent vectors at once.
+    // Per-lane scalars such as dot products are packs; comparisons on them give
+    // masks that select() blends with.
+    template<typename T, std::size_t N, std::size_t Lanes>
+    struct WideVector {
+        using value_type = simd::Pack<T, Lanes>;
+        using mask_type = simd::Mask<T, Lanes>;
+        using scalar_type = T;
+        using scalar_vector = Vector<T, N>;
+        using size_type = std::size_t;
+
+        static constexpr auto lanes = Lanes;
+
+        [[nodiscard]] static WideVector broadcast(const scalar_vector& vector) noexcept
+        {
+            WideVector result;
+            for (std::size_t i = 0; i < N; ++i) {
+                result.components_[i] = value_type::broadcast(vector[i]);
+            }
+            return result;
+        }
+
+        // Lane i from vectors[i]. Throws std::invalid_argument when vectors holds fewer than lanes elements.
+        [[nodiscard]] static WideVector load(std::span<const scalar_vector> vectors)
+        {
+            check_size(vectors.size());
+            WideVector result;
+            for (std::size_t i = 0; i < N; ++i) {
+                std::array<T, Lanes> component;
+                for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                    component[lane] = vectors[lane][i];
+                }
+                result.components_[i] = value_type::load(component.data());
+            }
+            return result;
+        }
+
+        void store(std::span<scalar_vector> vectors) const
+        {
+            check_size(vectors.size());
+            for (std::size_t i = 0; i < N; ++i) {
+                std::array<T, Lanes> component;
+                components_[i].store(component.data());
+                for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                    vectors[lane][i] = component[lane];
+                }
+            }
+        }
+
+        [[nodiscard]] scalar_vector lane(size_type lane) const noexcept
+        {
+            scalar_vector result;
+            for (std::size_t i = 0; i < N; ++i) {
+                result[i] = components_[i][lane];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return N; }
+
+        [[nodiscard]] constexpr value_type& operator[](size_type pos) noexcept { return components_[pos]; }
+        [[nodiscard]] constexpr const value_type& operator[](size_type pos) const noexcept { return components_[pos]; }
+
+        [[nodiscard]] constexpr value_type& x() noexcept requires(N > 0) { return components_[0]; }
+        [[nodiscard]] constexpr const value_type& x() const noexcept requires(N > 0) { return components_[0]; }
+        [[nodiscard]] constexpr value_type& y() noexcept requires(N > 1) { return components_[1]; }
+        [[nodiscard]] constexpr const value_type& y() const noexcept requires(N > 1) { return components_[1]; }
+        [[nodiscard]] constexpr value_type& z() noexcept requires(N > 2) { return components_[2]; }
+        [[nodiscard]] constexpr const value_type& z() const noexcept requires(N > 2) { return components_[2]; }
+        [[nodiscard]] constexpr value_type& w() noexcept requires(N > 3) { return components_[3]; }
+        [[nodiscard]] constexpr const value_type& w() const noexcept requires(N > 3) { return components_[3]; }
+
+        [[nodiscard]] value_type sqr_magnitude() const noexcept
+        {
+            auto result = components_[0] * components_[0];
+            for (std::size_t i = 1; i < N; ++i) {
+                result = fmadd(components_[i], components_[i], result);
+            }
+            return result;
+        }
+
+        [[nodiscard]] value_type magnitude() const noexcept { return sqrt(sqr_magnitude()); }
+
+        // Zero length lanes come out as NaN, like Vector::normalized
+        [[nodiscard]] WideVector normalized() const noexcept
+        {
+            return *this * (value_type::broadcast(T{1}) / magnitude());
+        }
+
+        WideVector& normalize() noexcept
+        {
+            *this = normalized();
+            return *this;
+        }
+
+        [[nodiscard]] friend WideVector operator+(const WideVector& lhs, const WideVector& rhs) noexcept
+        {
+            return apply(lhs, rhs, [](const value_type& l, const value_type& r) { return l + r; });
+        }
+
+        [[nodiscard]] friend WideVector operator-(const WideVector& lhs, const WideVector& rhs) noexcept
+        {
+            return apply(lhs, rhs, [](const value_type& l, const value_type& r) { return l - r; });
+        }
+
+        [[nodiscard]] friend WideVector operator-(const WideVector& vector) noexcept
+        {
+            return apply(vector, vector, [](const value_type& l, const value_type&) { return -l; });
+        }
+
+        // Scales every lane by its own factor
+        [[nodiscard]] friend WideVector operator*(const WideVector& vector, const value_type& scalar) noexcept
+        {
+            return apply(vector, vector, [&scalar](const value_type& l, const value_type&) { return l * scalar; });
+        }
+        [[nodiscard]] friend WideVector operator*(const value_type& scalar, const WideVector& vector) noexcept { return vector * scalar; }
+        [[nodiscard]] friend WideVector operator*(const WideVector& vector, T scalar) noexcept { return vector * value_type::broadcast(scalar); }
+        [[nodiscard]] friend WideVector operator*(T scalar, const WideVector& vector) noexcept { return vector * value_type::broadcast(scalar); }
+
+        [[nodiscard]] friend WideVector operator/(const WideVector& vector, const value_type& scalar) noexcept
+        {
+            return apply(vector, vector, [&scalar](const value_type& l, const value_type&) { return l / scalar; });
+        }
+        [[nodiscard]] friend WideVector operator/(const WideVector& vector, T scalar) noexcept { return vector / value_type::broadcast(scalar); }
+
+        std::array<value_type, N> components_; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    private:
+        static void check_size(std::size_t size)
+        {
+            if (size < Lanes) {
+                throw std::invalid_argument("span must hold at least one vector per lane");
+            }
+        }
+
+        template<typename Operation>
+        [[nodiscard]] static WideVector apply(const WideVector& lhs, const WideVector& rhs, Operation operation) noexcept
+        {
+            WideVector result;
+            for (std::size_t i = 0; i < N; ++i) {
+                result.components_[i] = operation(lhs.components_[i], rhs.components_[i]);
+            }
+            return result;
+        }
+    };
+
+    template<typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] simd::Pack<T, Lanes> dot(const WideVector<T, N, Lanes>& lhs, const WideVector<T, N, Lanes>& rhs) noexcept
+    {
+        auto result = lhs[0] * rhs[0];
+        for (std::size_t i = 1; i < N; ++i) {
+            result = fmadd(lhs[i], rhs[i], result);
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, 3, Lanes> cross(const WideVector<T, 3, Lanes>& lhs, const WideVector<T, 3, Lanes>& rhs) noexcept
+    {
+        return {{
+            difference_of_products(lhs[1], rhs[2], lhs[2], rhs[1]),
+            difference_of_products(lhs[2], rhs[0], lhs[0], rhs[2]),
+            difference_of_products(lhs[0], rhs[1], lhs[1], rhs[0])}};
+    }
+
+    template<typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, N, Lanes> lerp(const WideVector<T, N, Lanes>& from, const WideVector<T, N, Lanes>& to, const simd::Pack<T, Lanes>& t) noexcept
+    {
+        WideVector<T, N, Lanes> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = fmadd(to[i] - from[i], t, from[i]);
+        }
+        return result;
+    }
+
+    // Component-wise minimum and maximum, the building blocks of wide bounding boxes
+    template<typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, N, Lanes> min(const WideVector<T, N, Lanes>& lhs, const WideVector<T, N, Lanes>& rhs) noexcept
+    {
+        WideVector<T, N, Lanes> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = min(lhs[i], rhs[i]);
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, N, Lanes> max(const WideVector<T, N, Lanes>& lhs, const WideVector<T, N, Lanes>& rhs) noexcept
+    {
+        WideVector<T, N, Lanes> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = max(lhs[i], rhs[i]);
+        }
+        return result;
+    }
+
+    // Lanes of if_true where mask is set, of if_false elsewhere
+    template<typename T, std::size_t N, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, N, Lanes> select(const simd::Mask<T, Lanes>& mask, const WideVector<T, N, Lanes>& if_true, const WideVector<T, N, Lanes>& if_false) noexcept
+    {
+        WideVector<T, N, Lanes> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = select(mask, if_true[i], if_false[i]);
+        }
+        return result;
+    }
+
+    // Point with an implied w of 1 in the row vector convention, as the scalar transform_point
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, 3, Lanes> transform_point(const WideVector<T, 3, Lanes>& point, const Matrix4_t<T>& matrix) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        WideVector<T, 3, Lanes> result;
+        for (std::size_t j = 0; j < 3; ++j) {
+            result[j] = fmadd(point[0], Pack::broadcast(matrix[0][j]),
+                              fmadd(point[1], Pack::broadcast(matrix[1][j]),
+                                    fmadd(point[2], Pack::broadcast(matrix[2][j]), Pack::broadcast(matrix[3][j]))));
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, 3, Lanes> transform(const WideVector<T, 3, Lanes>& vector, const Matrix4_t<T>& transform) noexcept
+    {
+        return transform_point(vector, transform);
+    }
+
+    // Direction with an implied w of 0, as the scalar transform_direction
+    template<typename T, std::size_t Lanes>
+    [[nodiscard]] WideVector<T, 3, Lanes> transform_direction(const WideVector<T, 3, Lanes>& direction, const Matrix4_t<T>& matrix) noexcept
+    {
+        using Pack = simd::Pack<T, Lanes>;
+        WideVector<T, 3, Lanes> result;
+        for (std::size_t j = 0; j < 3; ++j) {
+            result[j] = fmadd(direction[0], Pack::broadcast(matrix[0][j]),
+                              fmadd(direction[1], Pack::broadcast(matrix[1][j]), direction[2] * Pack::broadcast(matrix[2][j])));
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t Lanes>
+    using WideVector2_t = WideVector<T, 2, Lanes>;
+    template<typename T, std::size_t Lanes>
+    using WideVector3_t = WideVector<T, 3, Lanes>;
+    template<typename T, std::size_t Lanes>
+    using WideVector4_t = WideVector<T, 4, Lanes>;
+
+    // SSE width
+    using Vector2x4_f = WideVector2_t<float, 4>;
+    using Vector3x4_f = WideVector3_t<float, 4>;
+    using Vector4x4_f = WideVector4_t<float, 4>;
+    // AVX width. Without AVX each component is a plain array pack, prefer the x4 types there
+    using Vector2x8_f = WideVector2_t<float, 8>;
+    using Vector3x8_f = WideVector3_t<float, 8>;
+    using Vector4x8_f = WideVector4_t<float, 8>;
+    using Vector3x4_d = WideVector3_t<double, 4>;
+} // namespace orion::math
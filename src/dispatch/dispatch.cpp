@@ -0,0 +1,191 @@
+#include "orion-math/dispatch/dispatch.h"
+
+#include "orion-math/instrument.h" // ORION_MATH_INSTRUMENT_BATCH
+
+#include "kernels.h"
+
+#include <atomic>      // std::atomic
+#include <cstdlib>     // std::getenv
+#include <stdexcept>   // std::invalid_argument
+#include <string>      // std::string
+#include <type_traits> // std::conditional_t, std::is_const_v
+
+#if defined(ORION_MATH_DISPATCH_X86) && defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h> // __cpuid, __cpuidex, _xgetbv
+#endif
+
+namespace orion::math::dispatch
+{
+    namespace
+    {
+        static_assert(sizeof(Vector3_f) == 3 * sizeof(float), "kernels expect tightly packed vectors");
+        static_assert(sizeof(Matrix4_f) == 16 * sizeof(float), "kernels expect tightly packed matrices");
+
+#if defined(ORION_MATH_DISPATCH_X86) && defined(_MSC_VER) && !defined(__clang__)
+        Isa query_isa() noexcept
+        {
+            int info[4]{};
+            __cpuid(info, 0);
+            const auto max_leaf = info[0];
+            __cpuid(info, 1);
+            const bool sse42 = (info[2] & (1 << 20)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            const bool os_saves_zmm = os_saves_ymm && (_xgetbv(0) & 0xe6) == 0xe6;
+            bool avx2 = false;
+            bool avx512 = false;
+            if (max_leaf >= 7) {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+                avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1u << 31)) != 0;
+            }
+            if (avx512 && avx2 && fma && os_saves_zmm) {
+                return Isa::avx512;
+            }
+            if (avx2 && fma && os_saves_ymm) {
+                return Isa::avx2;
+            }
+            return sse42 ? Isa::sse42 : Isa::baseline;
+        }
+#elif defined(ORION_MATH_DISPATCH_X86)
+        Isa query_isa() noexcept
+        {
+            // __builtin_cpu_supports also checks that the OS saves the wider registers
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return Isa::avx512;
+            }
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return Isa::avx2;
+            }
+            return __builtin_cpu_supports("sse4.2") ? Isa::sse42 : Isa::baseline;
+        }
+#else
+        Isa query_isa() noexcept
+        {
+            return Isa::baseline;
+        }
+#endif
+
+        const detail::KernelTable& kernels_for(Isa isa) noexcept
+        {
+            switch (isa) {
+#if defined(ORION_MATH_DISPATCH_X86)
+                case Isa::avx512:
+                    return detail::avx512_kernels;
+                case Isa::avx2:
+                    return detail::avx2_kernels;
+                case Isa::sse42:
+                    return detail::sse42_kernels;
+#endif
+                default:
+                    return detail::baseline_kernels;
+            }
+        }
+
+        struct State {
+            Isa detected;
+            std::atomic<Isa> active;
+        };
+
+        Isa initial_isa(Isa detected) noexcept
+        {
+            const char* name = std::getenv("ORION_MATH_ISA");
+            if (name == nullptr) {
+                return detected;
+            }
+            const auto requested = parse_isa(name);
+            return requested && *requested <= detected ? *requested : detected;
+        }
+
+        State& state() noexcept
+        {
+            static State instance = [] {
+                const auto detected = query_isa();
+                return State{detected, initial_isa(detected)};
+            }();
+            return instance;
+        }
+
+        // Vectors and matrices are tightly packed floats, see the static_asserts above
+        template<typename Vector>
+        auto components(std::span<Vector> vectors) noexcept
+        {
+            using Float = std::conditional_t<std::is_const_v<Vector>, const float, float>;
+            return reinterpret_cast<Float*>(vectors.data());
+        }
+
+        const detail::KernelTable& active_kernels() noexcept
+        {
+            return kernels_for(state().active.load(std::memory_order_relaxed));
+        }
+    } // namespace
+
+    std::string_view to_string(Isa isa) noexcept
+    {
+        switch (isa) {
+            case Isa::baseline:
+                return "baseline";
+            case Isa::sse42:
+                return "sse4.2";
+            case Isa::avx2:
+                return "avx2";
+            case Isa::avx512:
+                return "avx512";
+        }
+        return "unknown";
+    }
+
+    std::optional<Isa> parse_isa(std::string_view name) noexcept
+    {
+        for (const auto isa : {Isa::baseline, Isa::sse42, Isa::avx2, Isa::avx512}) {
+            if (name == to_string(isa)) {
+                return isa;
+            }
+        }
+        return std::nullopt;
+    }
+
+    Isa detected_isa() noexcept
+    {
+        return state().detected;
+    }
+
+    Isa active_isa() noexcept
+    {
+        return state().active.load(std::memory_order_relaxed);
+    }
+
+    void force_isa(Isa isa)
+    {
+        auto& current = state();
+        if (isa > current.detected) {
+            throw std::invalid_argument("instruction set " + std::string{to_string(isa)} + " is not supported by this host");
+        }
+        current.active.store(isa, std::memory_order_relaxed);
+    }
+
+    void transform_points(std::span<const Vector3_f> points, const Matrix4_f& matrix, std::span<Vector3_f> result)
+    {
+        if (points.size() != result.size()) {
+            throw std::invalid_argument("batch spans must have the same size");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(points.size());
+        active_kernels().transform_points(components(points), points.size(), matrix.data(), components(result));
+    }
+
+    void normalize(std::span<Vector3_f> vectors)
+    {
+        ORION_MATH_INSTRUMENT_BATCH(vectors.size());
+        active_kernels().normalize(components(vectors), vectors.size());
+    }
+
+    void dot(std::span<const Vector3_f> lhs, std::span<const Vector3_f> rhs, std::span<float> result)
+    {
+        if (lhs.size() != rhs.size() || lhs.size() != result.size()) {
+            throw std::invalid_argument("batch spans must have the same size");
+        }
+        ORION_MATH_INSTRUMENT_BATCH(lhs.size());
+        active_kernels().dot(components(lhs), components(rhs), lhs.size(), result.data());
+    }
+} // namespace orion::math::dispatch
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef> // std::size_t
+
+// Kernels work on flattened float arrays only. Translation units built with
+// wider instruction sets must not instantiate inline functions shared with
+// the rest of the program, otherwise the linker may pick their copy for
+// callers running on hosts without those instructions.
+namespace orion::math::dispatch::detail
+{
+    struct KernelTable {
+        void (*transform_points)(const float* points, std::size_t count, const float* matrix, float* result) noexcept;
+        void (*normalize)(float* vectors, std::size_t count) noexcept;
+        void (*dot)(const float* lhs, const float* rhs, std::size_t count, float* result) noexcept;
+    };
+
+    extern const KernelTable baseline_kernels;
+#if defined(ORION_MATH_DISPATCH_X86)
+    extern const KernelTable sse42_kernels;
+    extern const KernelTable avx2_kernels;
+    extern const KernelTable avx512_kernels;
+#endif
+} // namespace orion::math::dispatch::detail
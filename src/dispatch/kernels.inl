@@ -0,0 +1,67 @@
+// Compiled once per instruction set, see kernels_*.cpp
+#if !defined(ORION_MATH_DISPATCH_KERNELS)
+    #error "define ORION_MATH_DISPATCH_KERNELS to the name of the kernel table"
+#endif
+
+#include "kernels.h"
+
+#include <cstddef> // std::size_t
+
+#if !defined(__GNUC__) && !defined(__clang__)
+    #include <cmath> // std::sqrt
+#endif
+
+namespace orion::math::dispatch::detail
+{
+    namespace
+    {
+        float square_root(float value) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_sqrtf(value);
+#else
+            return std::sqrt(value);
+#endif
+        }
+
+        // Plain loops over the components, vectorized by the compiler for the
+        // instruction set of the including translation unit
+        void transform_points(const float* points, std::size_t count, const float* matrix, float* result) noexcept
+        {
+            const float m00 = matrix[0], m01 = matrix[1], m02 = matrix[2];
+            const float m10 = matrix[4], m11 = matrix[5], m12 = matrix[6];
+            const float m20 = matrix[8], m21 = matrix[9], m22 = matrix[10];
+            const float m30 = matrix[12], m31 = matrix[13], m32 = matrix[14];
+            for (std::size_t i = 0; i < count; ++i) {
+                const float x = points[3 * i];
+                const float y = points[3 * i + 1];
+                const float z = points[3 * i + 2];
+                result[3 * i] = x * m00 + y * m10 + z * m20 + m30;
+                result[3 * i + 1] = x * m01 + y * m11 + z * m21 + m31;
+                result[3 * i + 2] = x * m02 + y * m12 + z * m22 + m32;
+            }
+        }
+
+        void normalize(float* vectors, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                const float x = vectors[3 * i];
+                const float y = vectors[3 * i + 1];
+                const float z = vectors[3 * i + 2];
+                const float inverse_length = 1.f / square_root(x * x + y * y + z * z);
+                vectors[3 * i] = x * inverse_length;
+                vectors[3 * i + 1] = y * inverse_length;
+                vectors[3 * i + 2] = z * inverse_length;
+            }
+        }
+
+        void dot(const float* lhs, const float* rhs, std::size_t count, float* result) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                result[i] = lhs[3 * i] * rhs[3 * i] + lhs[3 * i + 1] * rhs[3 * i + 1] + lhs[3 * i + 2] * rhs[3 * i + 2];
+            }
+        }
+    } // namespace
+
+    extern const KernelTable ORION_MATH_DISPATCH_KERNELS{&transform_points, &normalize, &dot};
+} // namespace orion::math::dispatch::detail
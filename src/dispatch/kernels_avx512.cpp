@@ -0,0 +1,2 @@
+#define ORION_MATH_DISPATCH_KERNELS avx512_kernels
+#include "kernels.inl"
@@ -0,0 +1,2 @@
+#define ORION_MATH_DISPATCH_KERNELS baseline_kernels
+#include "kernels.inl"
@@ -0,0 +1,2 @@
+#define ORION_MATH_DISPATCH_KERNELS sse42_kernels
+#include "kernels.inl"
@@ -31,3 +31,10 @@ TEST(Abs, NegativeZero)
 {
     EXPECT_EQ(orion::math::abs(-0.0), 0.0);
 }
+
+TEST(Abs, IntegralStaysIntegral)
+{
+    static_assert(std::is_same_v<decltype(orion::math::abs(-15)), int>);
+    static_assert(orion::math::abs(-15) == 15);
+    static_assert(orion::math::abs(15U) == 15U);
+}
@@ -0,0 +1,166 @@
+#include "orion-math/matrix/aosoa.h"
+
+#include "orion-math/matrix/solve.h"
+
+#include <gtest/gtest.h>
+#include <cmath>     // std::isfinite
+#include <cstddef>   // std::size_t
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-3;
+
+    // Diagonally dominant, so every matrix is comfortably invertible
+    template<std::size_t N>
+    std::vector<orion::math::Matrix<float, N, N>> random_matrices(std::size_t count)
+    {
+        std::mt19937 engine{static_cast<unsigned>(count)};
+        std::uniform_real_distribution<float> distribution{-1, 1};
+        std::vector<orion::math::Matrix<float, N, N>> result(count);
+        for (auto& matrix : result) {
+            for (auto& row : matrix) {
+                for (auto& value : row) {
+                    value = distribution(engine);
+                }
+            }
+            for (std::size_t i = 0; i < N; ++i) {
+                matrix[i][i] += static_cast<float>(N);
+            }
+        }
+        return result;
+    }
+
+    template<std::size_t N>
+    void expect_matrix_near(const orion::math::Matrix<float, N, N>& actual, const orion::math::Matrix<float, N, N>& expected)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                EXPECT_NEAR(actual[i][j], expected[i][j], acceptable_error) << "at [" << i << "][" << j << "]";
+            }
+        }
+    }
+
+    TEST(Aosoa, PackUnpack)
+    {
+        const auto matrices = random_matrices<3>(19);
+        const orion::math::Matrix3Batch batch{matrices};
+        EXPECT_EQ(batch.size(), matrices.size());
+        EXPECT_EQ(batch.blocks().size(), 3);
+        EXPECT_EQ(batch[10], matrices[10]);
+        // Element [1][2] of the matrix in lane 3 of the second block
+        EXPECT_EQ(batch.blocks()[1][1 * 3 + 2][3], matrices[11][1][2]);
+
+        std::vector<orion::math::Matrix3> unpacked(matrices.size());
+        batch.unpack(unpacked);
+        EXPECT_EQ(unpacked, matrices);
+
+        std::vector<orion::math::Matrix3> wrong_size(4);
+        EXPECT_THROW(batch.unpack(wrong_size), std::invalid_argument);
+        auto copy = batch;
+        EXPECT_THROW(copy.set(19, orion::math::Matrix3::identity()), std::out_of_range);
+    }
+
+    TEST(Aosoa, Multiply)
+    {
+        const auto lhs = random_matrices<4>(21);
+        const auto rhs = random_matrices<4>(22);
+        const orion::math::Matrix4Batch lhs_batch{lhs};
+        const orion::math::Matrix4Batch rhs_batch{std::span{rhs}.first(lhs.size())};
+        orion::math::Matrix4Batch result{lhs.size()};
+        orion::math::batch_multiply(lhs_batch, rhs_batch, result);
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            expect_matrix_near(result[i], lhs[i] * rhs[i]);
+        }
+
+        auto in_place = lhs_batch;
+        orion::math::batch_multiply(in_place, rhs_batch, in_place);
+        EXPECT_EQ(in_place[20], result[20]);
+    }
+
+    template<std::size_t N>
+    void expect_inverse_and_determinant()
+    {
+        const auto matrices = random_matrices<N>(37);
+        const orion::math::MatrixBatch<float, N> batch{matrices};
+        orion::math::MatrixBatch<float, N> inverse{matrices.size()};
+        orion::math::batch_inverse(batch, inverse);
+        std::vector<float> determinants(matrices.size());
+        orion::math::batch_determinant(batch, std::span{determinants});
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            expect_matrix_near(matrices[i] * inverse[i], orion::math::Matrix<float, N, N>::identity());
+            const auto expected = orion::math::lu_decompose(matrices[i])->determinant();
+            EXPECT_NEAR(determinants[i], expected, acceptable_error * std::abs(expected));
+        }
+    }
+
+    TEST(Aosoa, InverseAndDeterminant)
+    {
+        expect_inverse_and_determinant<3>();
+        expect_inverse_and_determinant<4>();
+    }
+
+    TEST(Aosoa, SingularInverseIsNotFinite)
+    {
+        const std::vector<orion::math::Matrix3> matrices{orion::math::Matrix3::identity(), orion::math::Matrix3{}};
+        orion::math::Matrix3Batch batch{matrices};
+        orion::math::batch_inverse(batch, batch);
+        EXPECT_EQ(batch[0], orion::math::Matrix3::identity());
+        EXPECT_FALSE(std::isfinite(batch[1][0][0]));
+    }
+
+    template<std::size_t N>
+    void expect_solves()
+    {
+        const auto matrices = random_matrices<N>(45);
+        std::mt19937 engine{1};
+        std::uniform_real_distribution<float> distribution{-1, 1};
+        std::vector<orion::math::Vector<float, N>> b(matrices.size());
+        for (auto& vector : b) {
+            for (std::size_t i = 0; i < N; ++i) {
+                vector[i] = distribution(engine);
+            }
+        }
+
+        const orion::math::MatrixBatch<float, N> matrix_batch{matrices};
+        const orion::math::VectorBatch<float, N> b_batch{b};
+        orion::math::VectorBatch<float, N> x{b.size()};
+        orion::math::batch_solve(matrix_batch, b_batch, x);
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            const auto expected = *orion::math::solve(matrices[i], b[i]);
+            for (std::size_t j = 0; j < N; ++j) {
+                EXPECT_NEAR(x[i][j], expected[j], acceptable_error);
+            }
+        }
+    }
+
+    TEST(Aosoa, Solve)
+    {
+        expect_solves<3>();
+        expect_solves<4>();
+    }
+
+    TEST(Aosoa, Threads)
+    {
+        const auto matrices = random_matrices<4>(10'000);
+        const orion::math::Matrix4Batch batch{matrices};
+        orion::math::Matrix4Batch single{matrices.size()};
+        orion::math::Matrix4Batch threaded{matrices.size()};
+        orion::math::batch_inverse(batch, single);
+        orion::math::batch_inverse(batch, threaded, 4);
+        for (std::size_t i = 0; i < matrices.size(); i += 97) {
+            EXPECT_EQ(single[i], threaded[i]);
+        }
+    }
+
+    TEST(Aosoa, SizeMismatchThrows)
+    {
+        const orion::math::Matrix3Batch matrices{8};
+        orion::math::Matrix3Batch result{9};
+        EXPECT_THROW(orion::math::batch_inverse(matrices, result), std::invalid_argument);
+        std::vector<float> determinants(7);
+        EXPECT_THROW(orion::math::batch_determinant(matrices, std::span{determinants}), std::invalid_argument);
+    }
+} // namespace
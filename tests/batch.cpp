@@ -0,0 +1,68 @@
+#include "orion-math/matrix/batch.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+#include <vector> // std::vector
+
+namespace
+{
+    TEST(Batch, MultiplyElementwise)
+    {
+        const std::vector lhs{orion::math::scaling(2.f, 3.f, 4.f), orion::math::translation(1.f, 2.f, 3.f)};
+        const std::vector rhs{orion::math::translation(1.f, 2.f, 3.f), orion::math::rotation_x(orion::math::pi_rads)};
+        std::vector<orion::math::Matrix4> result(lhs.size());
+        orion::math::batch_multiply(lhs, rhs, result);
+        EXPECT_EQ(result[0], lhs[0] * rhs[0]);
+        EXPECT_EQ(result[1], lhs[1] * rhs[1]);
+    }
+
+    TEST(Batch, MultiplyBroadcast)
+    {
+        const std::vector<orion::math::Matrix4_d> lhs{orion::math::scaling(2.0, 3.0, 4.0), orion::math::Matrix4_d::identity()};
+        const auto rhs = orion::math::translation(1.0, 2.0, 3.0);
+        std::vector<orion::math::Matrix4_d> result(lhs.size());
+        orion::math::batch_multiply<double>(lhs, rhs, result);
+        EXPECT_EQ(result[0], lhs[0] * rhs);
+        EXPECT_EQ(result[1], rhs);
+    }
+
+    TEST(Batch, MultiplyInPlace)
+    {
+        std::vector matrices{orion::math::scaling(2.f, 2.f, 2.f)};
+        const auto rhs = orion::math::translation(1.f, 1.f, 1.f);
+        const auto expected = matrices[0] * rhs;
+        orion::math::batch_multiply(matrices, rhs, matrices);
+        EXPECT_EQ(matrices[0], expected);
+    }
+
+    TEST(Batch, MultiplySizeMismatch)
+    {
+        const std::vector<orion::math::Matrix4> lhs(2);
+        std::vector<orion::math::Matrix4> result(1);
+        EXPECT_THROW(orion::math::batch_multiply(lhs, lhs, result), std::invalid_argument);
+    }
+
+    TEST(Batch, MultiplyHierarchy)
+    {
+        const std::vector local{
+            orion::math::translation(1.f, 0.f, 0.f),
+            orion::math::translation(0.f, 1.f, 0.f),
+            orion::math::scaling(2.f, 2.f, 2.f)};
+        const std::vector<std::int32_t> parents{-1, 0, 1};
+        const auto root = orion::math::translation(0.f, 0.f, 5.f);
+        std::vector<orion::math::Matrix4> world(local.size());
+        orion::math::batch_multiply_hierarchy(local, parents, world, root);
+        EXPECT_EQ(world[0], local[0] * root);
+        EXPECT_EQ(world[1], local[1] * world[0]);
+        EXPECT_EQ(world[2], local[2] * world[1]);
+    }
+
+    TEST(Batch, MultiplyHierarchyInvalidParent)
+    {
+        const std::vector<orion::math::Matrix4> local(2, orion::math::Matrix4::identity());
+        const std::vector<std::int32_t> parents{-1, 1};
+        std::vector<orion::math::Matrix4> world(local.size());
+        EXPECT_THROW(orion::math::batch_multiply_hierarchy(local, parents, world), std::out_of_range);
+    }
+} // namespace
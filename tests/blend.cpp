@@ -0,0 +1,168 @@
+#include "orion-math/animation/blend.h"
+
+#include "orion-math/matrix/trs.h"
+
+#include <cmath>     // std::acos, std::abs
+#include <gtest/gtest.h>
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using namespace orion::math::angle_literals;
+
+    constexpr auto acceptable_error = 1e-5;
+
+    void expect_quaternion_near(const orion::math::Quaternion& actual, const orion::math::Quaternion& expected)
+    {
+        for (std::size_t i = 0; i < 4; ++i) {
+            EXPECT_NEAR(actual[i], expected[i], acceptable_error) << "at " << i;
+        }
+    }
+
+    std::vector<orion::math::Quaternion> random_rotations(std::size_t count, unsigned seed)
+    {
+        std::mt19937 generator{seed};
+        std::uniform_real_distribution<float> distribution{-1.f, 1.f};
+        std::vector<orion::math::Quaternion> rotations(count);
+        for (auto& rotation : rotations) {
+            rotation = orion::math::Quaternion{distribution(generator), distribution(generator), distribution(generator), distribution(generator)}.normalized();
+        }
+        return rotations;
+    }
+
+    TEST(Interpolation, LerpVector)
+    {
+        constexpr orion::math::Vector3 from{1, 2, 3};
+        constexpr orion::math::Vector3 to{3, 6, -1};
+        constexpr auto halfway = orion::math::lerp(from, to, .5f);
+        EXPECT_EQ(halfway, (orion::math::Vector3{2, 4, 1}));
+        EXPECT_EQ(orion::math::lerp(from, to, 0.f), from);
+        EXPECT_EQ(orion::math::lerp(from, to, 1.f), to);
+    }
+
+    TEST(Interpolation, SlerpHasConstantAngularVelocity)
+    {
+        const auto from = orion::math::quaternion_identity();
+        const auto to = orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 120_deg);
+        expect_quaternion_near(orion::math::slerp(from, to, .25f), orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 30_deg));
+        expect_quaternion_near(orion::math::slerp(from, to, .5f), orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 60_deg));
+        expect_quaternion_near(orion::math::slerp(from, to, 1.f), to);
+        // Midpoint of nlerp agrees with slerp by symmetry
+        expect_quaternion_near(orion::math::nlerp(from, to, .5f), orion::math::slerp(from, to, .5f));
+    }
+
+    TEST(Interpolation, ShortestArc)
+    {
+        const auto from = orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 10_deg);
+        const auto to = -orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 50_deg);
+        const auto expected = orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 30_deg);
+        expect_quaternion_near(orion::math::slerp(from, to, .5f), expected);
+        expect_quaternion_near(orion::math::nlerp(from, to, .5f), expected);
+        expect_quaternion_near(orion::math::slerp(from, from, .3f), from);
+    }
+
+    TEST(Interpolation, BatchMatchesScalar)
+    {
+        const auto from = random_rotations(103, 1);
+        const auto to = random_rotations(103, 2);
+        std::vector<float> weights(from.size());
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            weights[i] = static_cast<float>(i) / static_cast<float>(weights.size());
+        }
+
+        std::vector<orion::math::Quaternion> result(from.size());
+        orion::math::nlerp(from, to, weights, result);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            expect_quaternion_near(result[i], orion::math::nlerp(from[i], to[i], weights[i]));
+        }
+        orion::math::nlerp(from, to, .3f, result);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            expect_quaternion_near(result[i], orion::math::nlerp(from[i], to[i], .3f));
+        }
+        orion::math::slerp(from, to, weights, result);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            expect_quaternion_near(result[i], orion::math::slerp(from[i], to[i], weights[i]));
+        }
+
+        std::vector<orion::math::Vector3> positions(from.size());
+        orion::math::lerp(std::vector<orion::math::Vector3>(from.size(), {0, 0, 0}), std::vector<orion::math::Vector3>(from.size(), {2, 4, 8}), .25f, positions);
+        EXPECT_EQ(positions.back(), (orion::math::Vector3{.5f, 1, 2}));
+
+        EXPECT_THROW(orion::math::nlerp(from, to, std::span{weights}.first(3), result), std::invalid_argument);
+    }
+
+    TEST(Interpolation, BlendPosesMatchesTrsInterpolate)
+    {
+        constexpr std::size_t joints = 37;
+        const auto from_rotations = random_rotations(joints, 3);
+        const auto to_rotations = random_rotations(joints, 4);
+        std::vector<orion::math::Vector3> from_translations(joints);
+        std::vector<orion::math::Vector3> to_translations(joints);
+        std::vector<orion::math::Vector3> from_scales(joints, {1, 1, 1});
+        std::vector<orion::math::Vector3> to_scales(joints);
+        std::vector<float> weights(joints);
+        for (std::size_t i = 0; i < joints; ++i) {
+            const auto value = static_cast<float>(i);
+            from_translations[i] = {value, -value, 1};
+            to_translations[i] = {2 * value, 0, value};
+            to_scales[i] = {1 + value, 2, .5f};
+            weights[i] = static_cast<float>(i % 5) / 4;
+        }
+
+        std::vector<orion::math::Vector3> translations(joints);
+        std::vector<orion::math::Quaternion> rotations(joints);
+        std::vector<orion::math::Vector3> scales(joints);
+        const orion::math::PoseView<float> from{from_translations, from_rotations, from_scales};
+        const orion::math::PoseView<float> to{to_translations, to_rotations, to_scales};
+        const orion::math::PoseBuffer<float> result{translations, rotations, scales};
+        orion::math::blend_poses(from, to, weights, result, 2);
+
+        for (std::size_t i = 0; i < joints; ++i) {
+            const auto expected = orion::math::interpolate(orion::math::TRS<float>{from_translations[i], from_rotations[i], from_scales[i]},
+                                                           orion::math::TRS<float>{to_translations[i], to_rotations[i], to_scales[i]},
+                                                           weights[i]);
+            EXPECT_EQ(translations[i], expected.translation);
+            EXPECT_EQ(scales[i], expected.scale);
+            expect_quaternion_near(rotations[i], expected.rotation);
+        }
+
+        orion::math::blend_poses(from, to, 1.f, result);
+        EXPECT_EQ(translations, to_translations);
+        EXPECT_THROW(orion::math::blend_poses(from, to, std::span{weights}.first(4), result), std::invalid_argument);
+    }
+
+    TEST(Interpolation, BlendPosesIndependentOfChunking)
+    {
+        // Three chunks, none of them a whole number of SIMD batches
+        constexpr std::size_t joints = 3 * orion::math::parallel_min_chunk_size + 5;
+        const auto from_rotations = random_rotations(joints, 5);
+        const auto to_rotations = random_rotations(joints, 6);
+        std::vector<orion::math::Vector3> from_vectors(joints);
+        std::vector<orion::math::Vector3> to_vectors(joints);
+        std::vector<float> weights(joints);
+        for (std::size_t i = 0; i < joints; ++i) {
+            const auto value = static_cast<float>(i) / joints;
+            from_vectors[i] = {value, 1 - value, 2};
+            to_vectors[i] = {-value, value, 3 * value};
+            weights[i] = value;
+        }
+        const orion::math::PoseView<float> from{from_vectors, from_rotations, from_vectors};
+        const orion::math::PoseView<float> to{to_vectors, to_rotations, to_vectors};
+
+        std::vector<orion::math::Vector3> translations(joints);
+        std::vector<orion::math::Quaternion> rotations(joints);
+        std::vector<orion::math::Vector3> scales(joints);
+        orion::math::blend_poses(from, to, weights, orion::math::PoseBuffer<float>{translations, rotations, scales});
+
+        std::vector<orion::math::Vector3> threaded_translations(joints);
+        std::vector<orion::math::Quaternion> threaded_rotations(joints);
+        std::vector<orion::math::Vector3> threaded_scales(joints);
+        orion::math::blend_poses(from, to, weights, orion::math::PoseBuffer<float>{threaded_translations, threaded_rotations, threaded_scales}, 3);
+
+        EXPECT_EQ(translations, threaded_translations);
+        EXPECT_EQ(rotations, threaded_rotations);
+        EXPECT_EQ(scales, threaded_scales);
+    }
+} // namespace
@@ -0,0 +1,169 @@
+#include "orion-math/animation/compression.h"
+
+#include <cmath>     // std::acos, std::cos, std::sin
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using namespace orion::math::angle_literals;
+
+    struct TestClip {
+        std::size_t joints = 0;
+        std::vector<orion::math::Vector3_f> translations;
+        std::vector<orion::math::Quaternion_f> rotations;
+        std::vector<orion::math::Vector3_f> scales;
+
+        [[nodiscard]] orion::math::RawClip raw() const { return {30.f, joints, translations, rotations, scales}; }
+    };
+
+    // Joint 0 moves along a smooth path, joint 1 spins at constant speed and
+    // joint 2 does not move at all
+    TestClip make_clip(std::size_t frames)
+    {
+        TestClip clip;
+        clip.joints = 3;
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            const auto time = static_cast<float>(frame) / 30.f;
+            clip.translations.push_back({std::sin(time * 2.f), std::cos(time) * 3.f, time});
+            clip.translations.push_back({0.f, 1.f, 0.f});
+            clip.translations.push_back({4.f, 5.f, 6.f});
+
+            clip.rotations.push_back(orion::math::quaternion_from_axis_angle(orion::math::Vector3_f{0.f, 1.f, 0.f}, orion::math::Radians{std::sin(time) * 1.5}));
+            clip.rotations.push_back(orion::math::quaternion_from_axis_angle(orion::math::Vector3_f{0.f, 0.f, 1.f}, orion::math::Radians{static_cast<double>(time)}));
+            clip.rotations.push_back(orion::math::quaternion_identity());
+
+            clip.scales.push_back({1.f, 1.f + .5f * std::sin(time), 1.f});
+            clip.scales.push_back({1.f, 1.f, 1.f});
+            clip.scales.push_back({2.f, 2.f, 2.f});
+        }
+        return clip;
+    }
+
+    float rotation_error(const orion::math::Quaternion_f& lhs, const orion::math::Quaternion_f& rhs)
+    {
+        return 2.f * std::acos(std::min(1.f, std::abs(orion::math::dot(lhs, rhs))));
+    }
+
+    TEST(ClipCompression, ErrorBoundedAtEveryFrame)
+    {
+        constexpr std::size_t frames = 240;
+        const auto clip = make_clip(frames);
+        const orion::math::ClipCompressionSettings settings{};
+        const auto compressed = orion::math::compress_clip(clip.raw(), settings);
+        ASSERT_EQ(compressed.frame_count, frames);
+        EXPECT_FLOAT_EQ(compressed.duration(), 239.f / 30.f);
+
+        std::vector<orion::math::Vector3_f> translations(clip.joints);
+        std::vector<orion::math::Quaternion_f> rotations(clip.joints);
+        std::vector<orion::math::Vector3_f> scales(clip.joints);
+        orion::math::ClipSampler sampler{compressed};
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            sampler.sample(static_cast<float>(frame) / 30.f, {translations, rotations, scales});
+            for (std::size_t joint = 0; joint < clip.joints; ++joint) {
+                const auto index = frame * clip.joints + joint;
+                // Quantization adds a little on top of the reduction tolerance
+                ASSERT_LE(std::sqrt((translations[joint] - clip.translations[index]).sqr_magnitude()), settings.translation_error + 2e-4f) << frame << " " << joint;
+                ASSERT_LE(rotation_error(rotations[joint], clip.rotations[index]), settings.rotation_error + 3e-4f) << frame << " " << joint;
+                ASSERT_LE(std::sqrt((scales[joint] - clip.scales[index]).sqr_magnitude()), settings.scale_error + 5e-5f) << frame << " " << joint;
+            }
+        }
+    }
+
+    TEST(ClipCompression, RemovesRedundantKeys)
+    {
+        const auto clip = make_clip(240);
+        const auto compressed = orion::math::compress_clip(clip.raw());
+
+        // Static channels keep only their end points, constant rotation speed
+        // needs more than two keys only because nlerp is not constant speed
+        EXPECT_EQ(compressed.translations.channels[1].key_count, 2);
+        EXPECT_EQ(compressed.translations.channels[2].key_count, 2);
+        EXPECT_EQ(compressed.rotations.channels[2].key_count, 2);
+        EXPECT_EQ(compressed.scales.channels[1].key_count, 2);
+        EXPECT_LT(compressed.rotations.channels[1].key_count, 60);
+
+        // The moving channels of joint 0 change too fast for many keys to go at
+        // these tolerances, everything else shrinks to a handful of keys
+        const auto raw_size = clip.translations.size() * sizeof(orion::math::Vector3_f) * 2 + clip.rotations.size() * sizeof(orion::math::Quaternion_f);
+        EXPECT_LT(compressed.size_bytes() * 5, raw_size);
+    }
+
+    TEST(ClipCompression, LongStaticAndLinearChannels)
+    {
+        // Half an hour at 30 Hz, which a quadratic reduction would take minutes on
+        constexpr std::size_t frames = 54'000;
+        TestClip clip;
+        clip.joints = 2;
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            const auto time = static_cast<float>(frame) / 30.f;
+            clip.translations.push_back({1.f, 2.f, 3.f});
+            clip.translations.push_back({time * .01f, 0.f, 0.f});
+            clip.rotations.push_back(orion::math::quaternion_identity());
+            clip.rotations.push_back(orion::math::quaternion_identity());
+            clip.scales.push_back({1.f, 1.f, 1.f});
+            clip.scales.push_back({1.f, 1.f, 1.f});
+        }
+
+        const auto compressed = orion::math::compress_clip(clip.raw());
+        EXPECT_EQ(compressed.translations.channels[0].key_count, 2);
+        EXPECT_LE(compressed.translations.channels[1].key_count, 4);
+        EXPECT_EQ(compressed.rotations.channels[1].key_count, 2);
+        EXPECT_EQ(compressed.scales.channels[0].key_count, 2);
+    }
+
+    TEST(ClipCompression, SamplesBetweenFramesAndOutOfOrder)
+    {
+        const auto clip = make_clip(90);
+        const auto compressed = orion::math::compress_clip(clip.raw());
+        std::vector<orion::math::Vector3_f> translations(clip.joints);
+        std::vector<orion::math::Quaternion_f> rotations(clip.joints);
+        std::vector<orion::math::Vector3_f> scales(clip.joints);
+        const orion::math::PoseBuffer<float> pose{translations, rotations, scales};
+
+        orion::math::ClipSampler sampler{compressed};
+        sampler.sample(2.5f, pose);
+        const auto late = translations[0];
+        sampler.sample(.5f / 30.f, pose);
+        // Halfway between the first two frames
+        const auto expected = (clip.translations[0] + clip.translations[3]) * .5f;
+        EXPECT_NEAR(translations[0].x(), expected.x(), 2e-3);
+        EXPECT_NEAR(translations[0].y(), expected.y(), 2e-3);
+
+        orion::math::ClipSampler fresh{compressed};
+        fresh.sample(2.5f, pose);
+        EXPECT_EQ(translations[0], late);
+
+        // Clamped past the end
+        fresh.sample(100.f, pose);
+        EXPECT_NEAR(translations[0].z(), 89.f / 30.f, 1e-3);
+    }
+
+    TEST(ClipCompression, InvalidInput)
+    {
+        auto clip = make_clip(10);
+        clip.scales.pop_back();
+        EXPECT_THROW((void)orion::math::compress_clip(clip.raw()), std::invalid_argument);
+
+        const auto compressed = orion::math::compress_clip(make_clip(10).raw());
+        orion::math::ClipSampler sampler{compressed};
+        std::vector<orion::math::Vector3_f> translations(1);
+        std::vector<orion::math::Quaternion_f> rotations(1);
+        std::vector<orion::math::Vector3_f> scales(1);
+        EXPECT_THROW(sampler.sample(0.f, {translations, rotations, scales}), std::invalid_argument);
+    }
+
+    TEST(ClipCompression, SingleFrame)
+    {
+        const auto clip = make_clip(1);
+        const auto compressed = orion::math::compress_clip(clip.raw());
+        EXPECT_EQ(compressed.translations.channels[0].key_count, 1);
+        std::vector<orion::math::Vector3_f> translations(clip.joints);
+        std::vector<orion::math::Quaternion_f> rotations(clip.joints);
+        std::vector<orion::math::Vector3_f> scales(clip.joints);
+        orion::math::ClipSampler sampler{compressed};
+        sampler.sample(1.f, {translations, rotations, scales});
+        EXPECT_NEAR(translations[2].x(), 4.f, 1e-4);
+    }
+} // namespace
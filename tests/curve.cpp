@@ -0,0 +1,147 @@
+#include "orion-math/curve/arc_length.h"
+#include "orion-math/curve/spline.h"
+
+#include "orion-math/vector/vector2.h"
+#include "orion-math/vector/vector3.h"
+
+#include <cmath>     // std::sqrt
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-4;
+
+    void expect_vector_near(const orion::math::Vector3& actual, const orion::math::Vector3& expected, double error = acceptable_error)
+    {
+        for (std::size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(actual[i], expected[i], error) << "at " << i;
+        }
+    }
+
+    const std::vector<orion::math::Vector3> control{
+        {0, 0, 0},
+        {1, 2, 0},
+        {3, 3, 1},
+        {4, 0, 2},
+        {6, -1, 2},
+        {7, 1, 0},
+        {9, 0, -1}};
+
+    TEST(Spline, BezierMatchesSegmentFunction)
+    {
+        const auto spline = orion::math::CubicSpline<float, 3>::bezier(control);
+        ASSERT_EQ(spline.segment_count(), 2);
+        for (const auto t : {0.f, .3f, .7f, 1.f}) {
+            expect_vector_near(spline(t), orion::math::bezier(control[0], control[1], control[2], control[3], t));
+            expect_vector_near(spline(1 + t), orion::math::bezier(control[3], control[4], control[5], control[6], t));
+        }
+        expect_vector_near(spline(0), control[0]);
+        expect_vector_near(spline(2), control[6]);
+    }
+
+    TEST(Spline, CatmullRomInterpolates)
+    {
+        const auto spline = orion::math::CubicSpline<float, 3>::catmull_rom(control);
+        ASSERT_EQ(spline.segment_count(), control.size() - 3);
+        for (std::size_t i = 0; i <= spline.segment_count(); ++i) {
+            expect_vector_near(spline(static_cast<float>(i)), control[i + 1]);
+        }
+        expect_vector_near(spline(1.4f), orion::math::catmull_rom(control[1], control[2], control[3], control[4], .4f));
+    }
+
+    TEST(Spline, Hermite)
+    {
+        const std::vector<orion::math::Vector3> points{{0, 0, 0}, {1, 1, 0}, {2, 0, 1}};
+        const std::vector<orion::math::Vector3> tangents{{1, 0, 0}, {1, 0, 0}, {0, -1, 0}};
+        const auto spline = orion::math::CubicSpline<float, 3>::hermite(points, tangents);
+        expect_vector_near(spline(1), points[1]);
+        expect_vector_near(spline.derivative(1.f), tangents[1]);
+        expect_vector_near(spline.derivative(2.f), tangents[2]);
+        expect_vector_near(spline(.25f), orion::math::hermite(points[0], tangents[0], points[1], tangents[1], .25f));
+    }
+
+    TEST(Spline, BSplineIsContinuous)
+    {
+        const auto spline = orion::math::CubicSpline<float, 3>::bspline(control);
+        expect_vector_near(spline(.6f), orion::math::bspline(control[0], control[1], control[2], control[3], .6f));
+        for (std::size_t i = 1; i < spline.segment_count(); ++i) {
+            const auto joint = static_cast<float>(i);
+            expect_vector_near(spline(joint - 1e-4f), spline(joint), 1e-3);
+            expect_vector_near(spline.derivative(joint - 1e-4f), spline.derivative(joint), 1e-2);
+        }
+    }
+
+    TEST(Spline, InvalidControlPoints)
+    {
+        using Spline = orion::math::CubicSpline<float, 3>;
+        EXPECT_THROW((void)Spline::bezier(std::span{control}.first(5)), std::invalid_argument);
+        EXPECT_THROW((void)Spline::catmull_rom(std::span{control}.first(3)), std::invalid_argument);
+        EXPECT_THROW((void)Spline::hermite(control, std::span{control}.first(2)), std::invalid_argument);
+    }
+
+    TEST(Spline, BatchEvaluate)
+    {
+        const auto spline = orion::math::CubicSpline<float, 3>::catmull_rom(control);
+        std::vector<float> parameters;
+        for (int i = -3; i < 90; ++i) {
+            parameters.push_back(static_cast<float>(i) * .05f);
+        }
+        std::vector<orion::math::Vector3> result(parameters.size());
+        orion::math::evaluate(spline, parameters, result);
+        for (std::size_t i = 0; i < parameters.size(); ++i) {
+            expect_vector_near(result[i], spline(parameters[i]));
+        }
+        EXPECT_THROW(orion::math::evaluate(spline, parameters, std::span{result}.first(2)), std::invalid_argument);
+    }
+
+    TEST(Spline, UniformForwardDifferencing)
+    {
+        const auto spline = orion::math::CubicSpline<double, 3>::bspline(std::vector<orion::math::Vector3_d>{{0, 0, 0}, {1, 2, 0}, {3, 3, 1}, {4, 0, 2}, {6, -1, 2}, {7, 1, 0}});
+        std::vector<orion::math::Vector3_d> result(1001);
+        orion::math::evaluate_uniform(spline, .1, 2.9, result, 3);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            const auto expected = spline(.1 + static_cast<double>(i) * 2.8 / 1000);
+            for (std::size_t j = 0; j < 3; ++j) {
+                ASSERT_NEAR(result[i][j], expected[j], 1e-9) << "at " << i;
+            }
+        }
+    }
+
+    TEST(ArcLength, StraightLine)
+    {
+        const std::vector<orion::math::Vector2> points{{0, 0}, {1, 0}, {2, 0}, {4, 0}};
+        const auto spline = orion::math::CubicSpline<float, 2>::bezier(points);
+        const orion::math::ArcLengthTable table{spline};
+        EXPECT_NEAR(table.length(), 4, acceptable_error);
+        EXPECT_NEAR(table.parameter_at(0), 0, acceptable_error);
+        EXPECT_NEAR(table.parameter_at(100), 1, acceptable_error);
+        EXPECT_NEAR(spline(table.parameter_at(1.5f)).x(), 1.5f, 1e-2);
+    }
+
+    TEST(ArcLength, QuarterCircle)
+    {
+        // Cubic Bezier approximation of a unit quarter circle
+        constexpr float k = .5522847f;
+        const std::vector<orion::math::Vector2> points{{1, 0}, {1, k}, {k, 1}, {0, 1}};
+        const auto spline = orion::math::CubicSpline<float, 2>::bezier(points);
+        const orion::math::ArcLengthTable table{spline, 32};
+        EXPECT_NEAR(table.length(), 3.14159265 / 2, 1e-3);
+
+        std::vector<orion::math::Vector2> even(9);
+        orion::math::evaluate_evenly_spaced(spline, table, even);
+        for (std::size_t i = 1; i < even.size(); ++i) {
+            const auto chord = std::sqrt((even[i] - even[i - 1]).sqr_magnitude());
+            EXPECT_NEAR(chord, table.length() / 8, 2e-3);
+        }
+
+        const std::vector<float> distances{0.f, .5f, 1.f, 1.5f};
+        std::vector<float> parameters(distances.size());
+        orion::math::parameters_at(table, distances, parameters);
+        for (std::size_t i = 0; i < distances.size(); ++i) {
+            EXPECT_EQ(parameters[i], table.parameter_at(distances[i]));
+        }
+        EXPECT_LT(parameters[1], parameters[2]);
+    }
+} // namespace
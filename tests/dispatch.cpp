@@ -0,0 +1,111 @@
+#include "orion-math/dispatch/dispatch.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using orion::math::dispatch::Isa;
+    using namespace orion::math::angle_literals;
+
+    constexpr auto acceptable_error = 1e-5;
+
+    // Large enough to exercise the vector loops and their remainders
+    std::vector<orion::math::Vector3_f> make_vectors(std::size_t count, float offset)
+    {
+        std::vector<orion::math::Vector3_f> vectors;
+        vectors.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto value = static_cast<float>(i) + offset;
+            vectors.push_back({value, 2 - value, value * .5f + 1});
+        }
+        return vectors;
+    }
+
+    // Runs the body once for every instruction set available on this host
+    class Dispatch : public ::testing::Test
+    {
+    protected:
+        void TearDown() override { orion::math::dispatch::force_isa(orion::math::dispatch::detected_isa()); }
+
+        template<typename Fn>
+        static void for_each_isa(Fn fn)
+        {
+            for (const auto isa : {Isa::baseline, Isa::sse42, Isa::avx2, Isa::avx512}) {
+                if (isa > orion::math::dispatch::detected_isa()) {
+                    break;
+                }
+                orion::math::dispatch::force_isa(isa);
+                SCOPED_TRACE(orion::math::dispatch::to_string(isa));
+                fn();
+            }
+        }
+    };
+
+    TEST_F(Dispatch, ParseIsa)
+    {
+        for (const auto isa : {Isa::baseline, Isa::sse42, Isa::avx2, Isa::avx512}) {
+            EXPECT_EQ(orion::math::dispatch::parse_isa(orion::math::dispatch::to_string(isa)), isa);
+        }
+        EXPECT_FALSE(orion::math::dispatch::parse_isa("neon").has_value());
+    }
+
+    TEST_F(Dispatch, ForceIsa)
+    {
+        orion::math::dispatch::force_isa(Isa::baseline);
+        EXPECT_EQ(orion::math::dispatch::active_isa(), Isa::baseline);
+        if (orion::math::dispatch::detected_isa() != Isa::avx512) {
+            EXPECT_THROW(orion::math::dispatch::force_isa(Isa::avx512), std::invalid_argument);
+        }
+    }
+
+    TEST_F(Dispatch, TransformPoints)
+    {
+        const auto points = make_vectors(37, -5);
+        const auto matrix = orion::math::scaling(1.f, 2.f, 3.f) * orion::math::rotation_y(30_deg) * orion::math::translation(4.f, 5.f, 6.f);
+        for_each_isa([&] {
+            std::vector<orion::math::Vector3_f> result(points.size());
+            orion::math::dispatch::transform_points(points, matrix, result);
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                const auto expected = orion::math::transform(points[i], matrix);
+                EXPECT_NEAR(result[i].x(), expected.x(), acceptable_error * 10);
+                EXPECT_NEAR(result[i].y(), expected.y(), acceptable_error * 10);
+                EXPECT_NEAR(result[i].z(), expected.z(), acceptable_error * 10);
+            }
+        });
+    }
+
+    TEST_F(Dispatch, Normalize)
+    {
+        for_each_isa([] {
+            auto vectors = make_vectors(37, .5f);
+            orion::math::dispatch::normalize(vectors);
+            for (const auto& vector : vectors) {
+                EXPECT_NEAR(vector.sqr_magnitude(), 1, acceptable_error);
+            }
+        });
+    }
+
+    TEST_F(Dispatch, Dot)
+    {
+        const auto lhs = make_vectors(37, 1);
+        const auto rhs = make_vectors(37, -3);
+        for_each_isa([&] {
+            std::vector<float> result(lhs.size());
+            orion::math::dispatch::dot(lhs, rhs, result);
+            for (std::size_t i = 0; i < lhs.size(); ++i) {
+                EXPECT_FLOAT_EQ(result[i], orion::math::dot(lhs[i], rhs[i]));
+            }
+        });
+    }
+
+    TEST_F(Dispatch, SizeMismatch)
+    {
+        const auto points = make_vectors(4, 0);
+        std::vector<orion::math::Vector3_f> result(3);
+        EXPECT_THROW(orion::math::dispatch::transform_points(points, orion::math::Matrix4_f::identity(), result), std::invalid_argument);
+    }
+} // namespace
@@ -0,0 +1,99 @@
+#include "orion-math/matrix/eigen.h"
+
+#include <cmath>  // std::abs
+#include <gtest/gtest.h>
+#include <vector> // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-5;
+
+    // vectors^T * diag(values) * vectors must give back the input
+    template<typename T>
+    void expect_reconstructs(const orion::math::Matrix3_t<T>& matrix, const orion::math::SymmetricEigen3<T>& eigen)
+    {
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                T value{0};
+                for (std::size_t k = 0; k < 3; ++k) {
+                    value += eigen.vectors[k][i] * eigen.values[k] * eigen.vectors[k][j];
+                }
+                EXPECT_NEAR(value, matrix[i][j], acceptable_error * 10) << "at [" << i << "][" << j << "]";
+            }
+        }
+    }
+
+    template<typename T>
+    void expect_orthonormal(const orion::math::Matrix3_t<T>& vectors)
+    {
+        const auto product = vectors * vectors.transpose();
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(product[i][j], i == j ? 1 : 0, acceptable_error);
+            }
+        }
+        EXPECT_GT(orion::math::dot(orion::math::cross(vectors[0], vectors[1]), vectors[2]), 0);
+    }
+
+    TEST(Eigen, Diagonal)
+    {
+        const orion::math::Matrix3 matrix{
+            2, 0, 0,
+            0, 5, 0,
+            0, 0, -1};
+        const auto eigen = orion::math::eigen_symmetric(matrix);
+        const orion::math::Vector3 expected_values{5, 2, -1};
+        EXPECT_EQ(eigen.values, expected_values);
+        EXPECT_NEAR(std::abs(eigen.vectors[0][1]), 1, acceptable_error);
+        EXPECT_NEAR(std::abs(eigen.vectors[1][0]), 1, acceptable_error);
+        expect_orthonormal(eigen.vectors);
+    }
+
+    TEST(Eigen, Symmetric)
+    {
+        const orion::math::Matrix3 matrix{
+            4, 1, -2,
+            1, 2, 0,
+            -2, 0, 3};
+        const auto eigen = orion::math::eigen_symmetric(matrix);
+        EXPECT_GE(eigen.values[0], eigen.values[1]);
+        EXPECT_GE(eigen.values[1], eigen.values[2]);
+        EXPECT_NEAR(eigen.values[0] + eigen.values[1] + eigen.values[2], 9, acceptable_error);
+        expect_orthonormal(eigen.vectors);
+        expect_reconstructs(matrix, eigen);
+    }
+
+    TEST(Eigen, RepeatedEigenvalues)
+    {
+        const orion::math::Matrix3_d matrix{
+            2, 1, 1,
+            1, 2, 1,
+            1, 1, 2};
+        const auto eigen = orion::math::eigen_symmetric(matrix);
+        EXPECT_NEAR(eigen.values[0], 4, acceptable_error);
+        EXPECT_NEAR(eigen.values[1], 1, acceptable_error);
+        EXPECT_NEAR(eigen.values[2], 1, acceptable_error);
+        expect_orthonormal(eigen.vectors);
+        expect_reconstructs(matrix, eigen);
+    }
+
+    TEST(Eigen, Batch)
+    {
+        std::vector<orion::math::Matrix3> matrices;
+        for (int i = 0; i < 2000; ++i) {
+            const auto value = static_cast<float>(i % 17) * .25f;
+            matrices.push_back({
+                1 + value, value, -value,
+                value, 3, .5f,
+                -value, .5f, 2 - value});
+        }
+        std::vector<orion::math::SymmetricEigen3<float>> result(matrices.size());
+        orion::math::batch_eigen_symmetric(matrices, result, 4);
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            const auto expected = orion::math::eigen_symmetric(matrices[i]);
+            EXPECT_EQ(result[i].values, expected.values);
+            EXPECT_EQ(result[i].vectors, expected.vectors);
+        }
+        expect_reconstructs(matrices[5], result[5]);
+    }
+} // namespace
@@ -0,0 +1,69 @@
+#include "orion-math/fixed.h"
+
+#include "orion-math/vector/vector3.h"
+
+#include <gtest/gtest.h>
+#include <limits> // std::numeric_limits
+
+namespace
+{
+    using orion::math::Fixed16_16;
+
+    TEST(Fixed, Conversions)
+    {
+        static_assert(Fixed16_16{1}.raw() == 0x1'0000);
+        static_assert(Fixed16_16{0.5}.raw() == 0x8000);
+        static_assert(Fixed16_16{-1.5f}.raw() == -0x1'8000);
+        EXPECT_EQ(static_cast<double>(Fixed16_16{2.25}), 2.25);
+        EXPECT_EQ(static_cast<int>(Fixed16_16{-1.5}), -2);
+    }
+
+    TEST(Fixed, Arithmetic)
+    {
+        constexpr Fixed16_16 lhs{3.5};
+        constexpr Fixed16_16 rhs{-1.25};
+        static_assert(lhs + rhs == Fixed16_16{2.25});
+        static_assert(lhs - rhs == Fixed16_16{4.75});
+        static_assert(lhs * rhs == Fixed16_16{-4.375});
+        static_assert(lhs / Fixed16_16{2} == Fixed16_16{1.75});
+        static_assert(-lhs == Fixed16_16{-3.5});
+        static_assert(rhs < lhs);
+    }
+
+    TEST(Fixed, OverflowWraps)
+    {
+        // Constant evaluation rejects signed overflow, so these only compile when the wrap is defined
+        constexpr auto max = Fixed16_16::from_raw(std::numeric_limits<Fixed16_16::storage>::max());
+        constexpr auto min = Fixed16_16::from_raw(std::numeric_limits<Fixed16_16::storage>::min());
+        constexpr auto epsilon = Fixed16_16::from_raw(1);
+        static_assert(max + epsilon == min);
+        static_assert(min - epsilon == max);
+        static_assert(-min == min);
+    }
+
+    TEST(Fixed, CompoundAssignment)
+    {
+        Fixed16_16 value{1};
+        value += Fixed16_16{2};
+        value *= Fixed16_16{1.5};
+        value -= Fixed16_16{0.5};
+        value /= Fixed16_16{2};
+        EXPECT_EQ(value, Fixed16_16{2});
+    }
+
+    TEST(Fixed, Sqrt)
+    {
+        static_assert(orion::math::sqrt(Fixed16_16{16}) == Fixed16_16{4});
+        EXPECT_NEAR(static_cast<double>(orion::math::sqrt(Fixed16_16{2})), 1.41421356, 1.0 / 65'536);
+    }
+
+    TEST(Fixed, VectorComponent)
+    {
+        const orion::math::Vector3_t<Fixed16_16> vector{Fixed16_16{2}, Fixed16_16{3}, Fixed16_16{6}};
+        EXPECT_EQ(vector.sqr_magnitude(), Fixed16_16{49});
+        EXPECT_EQ(vector.magnitude(), Fixed16_16{7});
+        EXPECT_EQ(orion::math::dot(vector, vector), Fixed16_16{49});
+        const orion::math::Vector3_t<Fixed16_16> expected{Fixed16_16{4}, Fixed16_16{6}, Fixed16_16{12}};
+        EXPECT_EQ(vector + vector, expected);
+    }
+} // namespace
@@ -0,0 +1,30 @@
+#include "orion-math/fma.h"
+
+#include <gtest/gtest.h>
+
+TEST(Fmadd, ConstantEvaluated)
+{
+    static_assert(orion::math::fmadd(2.0, 3.0, 1.0) == 7.0);
+    static_assert(orion::math::fmadd(2, -3, 1) == -5);
+}
+
+TEST(Fmadd, Runtime)
+{
+    EXPECT_EQ(orion::math::fmadd(1.5f, 2.f, .25f), 3.25f);
+    EXPECT_EQ(orion::math::fmadd(2U, 3U, 4U), 10U);
+}
+
+#if defined(ORION_MATH_FMA) || defined(ORION_MATH_PRECISE_FMA)
+TEST(Fmadd, SingleRounding)
+{
+    // (1 + 2^-27)^2 - 1 loses the 2^-54 term when the product is rounded first
+    const auto value = 1.0 + 0x1p-27;
+    EXPECT_EQ(orion::math::fmadd(value, value, -1.0), 0x1p-26 + 0x1p-54);
+}
+#endif
+
+TEST(Fmadd, DifferenceOfProducts)
+{
+    static_assert(orion::math::difference_of_products(3, 4, 2, 5) == 2);
+    EXPECT_EQ(orion::math::difference_of_products(1.5f, 2.f, .5f, .5f), 2.75f);
+}
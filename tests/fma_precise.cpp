@@ -0,0 +1,46 @@
+// Built with ORION_MATH_PRECISE_FMA so the fused path is covered without hardware FMA flags
+#include "orion-math/fma.h"
+#include "orion-math/vector/vector3.h"
+
+#include <cmath>  // std::isnan
+#include <gtest/gtest.h>
+#include <limits> // std::numeric_limits
+
+#if !defined(ORION_MATH_PRECISE_FMA)
+    #error "fma_precise.cpp must be compiled with ORION_MATH_PRECISE_FMA"
+#endif
+
+TEST(FmaddPrecise, SingleRounding)
+{
+    // (1 + 2^-27)^2 - 1 loses the 2^-54 term when the product is rounded first
+    const auto value = 1.0 + 0x1p-27;
+    EXPECT_EQ(orion::math::fmadd(value, value, -1.0), 0x1p-26 + 0x1p-54);
+
+    const auto single = 1.f + 0x1p-12f;
+    EXPECT_EQ(orion::math::fmadd(single, single, -1.f), 0x1p-11f + 0x1p-24f);
+}
+
+TEST(FmaddPrecise, CrossSelfIsZero)
+{
+    // The products in each component are equal but not exactly representable
+    const orion::math::Vector3_f vector{.1f, .7f, 1.3f};
+    EXPECT_EQ(orion::math::cross(vector, vector), orion::math::Vector3_f{});
+
+    const orion::math::Vector3_d vector_d{.1, .7, 1.3};
+    EXPECT_EQ(orion::math::cross(vector_d, vector_d), orion::math::Vector3_d{});
+}
+
+TEST(FmaddPrecise, CrossAnticommutes)
+{
+    const orion::math::Vector3_f lhs{.1f, -2.3f, 7.9f};
+    const orion::math::Vector3_f rhs{3.7f, .45f, -1.1f};
+    EXPECT_EQ(orion::math::cross(lhs, rhs), -orion::math::cross(rhs, lhs));
+    EXPECT_EQ(orion::math::cross(lhs, rhs) + orion::math::cross(rhs, lhs), orion::math::Vector3_f{});
+}
+
+TEST(FmaddPrecise, DifferenceOfProductsInfinity)
+{
+    // The rounding error of an infinite product is inf - inf
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+    EXPECT_TRUE(std::isnan(orion::math::difference_of_products(infinity, 1.f, 1.f, 1.f)));
+}
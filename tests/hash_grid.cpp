@@ -0,0 +1,136 @@
+#include "orion-math/spatial/hash_grid.h"
+
+#include <algorithm> // std::ranges::sort
+#include <cstdint>   // std::uint32_t
+#include <gtest/gtest.h>
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    std::vector<orion::math::Vector3> random_points(std::size_t count)
+    {
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{-10.f, 10.f};
+        std::vector<orion::math::Vector3> points(count);
+        for (auto& point : points) {
+            point = {distribution(generator), distribution(generator), distribution(generator)};
+        }
+        return points;
+    }
+
+    TEST(SpatialHashGrid, CellOf)
+    {
+        const orion::math::SpatialHashGrid grid{2.f};
+        const orion::math::Vector3_i expected{0, -1, 2};
+        EXPECT_EQ(grid.cell_of({1.5f, -.5f, 4.f}), expected);
+    }
+
+    TEST(SpatialHashGrid, RadiusQueryMatchesBruteForce)
+    {
+        const auto points = random_points(3000);
+        orion::math::SpatialHashGrid grid{1.f};
+        grid.build(points);
+        EXPECT_EQ(grid.size(), points.size());
+
+        for (const orion::math::Vector3 center : {orion::math::Vector3{0, 0, 0}, orion::math::Vector3{5, -3, 2}, orion::math::Vector3{-9.5f, 9.5f, 0}}) {
+            for (const float radius : {.5f, 1.7f, 4.f}) {
+                std::vector<std::uint32_t> found;
+                grid.query_radius(center, radius, [&](std::uint32_t index) { found.push_back(index); });
+                std::vector<std::uint32_t> expected;
+                for (std::uint32_t i = 0; i < points.size(); ++i) {
+                    if ((points[i] - center).sqr_magnitude() <= radius * radius) {
+                        expected.push_back(i);
+                    }
+                }
+                std::ranges::sort(found);
+                EXPECT_EQ(found, expected);
+            }
+        }
+    }
+
+    TEST(SpatialHashGrid, AabbQueryMatchesBruteForce)
+    {
+        const auto points = random_points(3000);
+        orion::math::SpatialHashGrid grid{1.5f, 64};
+        grid.build(points);
+        EXPECT_EQ(grid.bucket_count(), 64);
+
+        const orion::math::Vector3 min{-3, 0, -1};
+        const orion::math::Vector3 max{2, 6, 4};
+        std::vector<std::uint32_t> found;
+        grid.query_aabb(min, max, [&](std::uint32_t index) { found.push_back(index); });
+        std::vector<std::uint32_t> expected;
+        for (std::uint32_t i = 0; i < points.size(); ++i) {
+            const auto& point = points[i];
+            if (point.x() >= min.x() && point.y() >= min.y() && point.z() >= min.z() && point.x() <= max.x() && point.y() <= max.y() && point.z() <= max.z()) {
+                expected.push_back(i);
+            }
+        }
+        std::ranges::sort(found);
+        EXPECT_EQ(found, expected);
+    }
+
+    TEST(SpatialHashGrid, Pairs)
+    {
+        const auto points = random_points(2000);
+        orion::math::SpatialHashGrid grid{.8f};
+        grid.build(points);
+        auto pairs = grid.find_pairs(.8f);
+
+        std::vector<orion::math::SpatialHashGrid<float>::Pair> expected;
+        for (std::uint32_t i = 0; i < points.size(); ++i) {
+            for (std::uint32_t j = i + 1; j < points.size(); ++j) {
+                if ((points[i] - points[j]).sqr_magnitude() <= .8f * .8f) {
+                    expected.emplace_back(i, j);
+                }
+            }
+        }
+        std::ranges::sort(pairs);
+        EXPECT_EQ(pairs, expected);
+    }
+
+    TEST(SpatialHashGrid, Threaded)
+    {
+        const auto points = random_points(20'000);
+        orion::math::SpatialHashGrid single_threaded{.5f};
+        orion::math::SpatialHashGrid multi_threaded{.5f};
+        single_threaded.build(points);
+        multi_threaded.build(points, 4);
+        EXPECT_EQ(single_threaded.find_pairs(.3f), multi_threaded.find_pairs(.3f, 4));
+    }
+
+    TEST(SpatialHashGrid, RebuildWithManyBuckets)
+    {
+        // 2^20 buckets take two radix passes, the second build shrinks the scratch use
+        orion::math::SpatialHashGrid grid{.25f, 1 << 20};
+        for (const std::size_t count : {20'000U, 700U}) {
+            const auto points = random_points(count);
+            grid.build(points, 3);
+            ASSERT_EQ(grid.size(), count);
+
+            std::vector<std::uint32_t> found;
+            grid.query_radius({1, 1, 1}, 3.f, [&](std::uint32_t index) { found.push_back(index); });
+            std::vector<std::uint32_t> expected;
+            for (std::uint32_t i = 0; i < points.size(); ++i) {
+                if ((points[i] - orion::math::Vector3{1, 1, 1}).sqr_magnitude() <= 9.f) {
+                    expected.push_back(i);
+                }
+            }
+            std::ranges::sort(found);
+            EXPECT_EQ(found, expected);
+        }
+    }
+
+    TEST(SpatialHashGrid, Empty)
+    {
+        orion::math::SpatialHashGrid grid{1.f};
+        grid.build({});
+        bool called = false;
+        grid.query_radius({0, 0, 0}, 10.f, [&](std::uint32_t) { called = true; });
+        EXPECT_FALSE(called);
+        EXPECT_TRUE(grid.find_pairs(1.f).empty());
+        EXPECT_THROW(orion::math::SpatialHashGrid{0.f}, std::invalid_argument);
+    }
+} // namespace
@@ -0,0 +1,91 @@
+#include "orion-math/instrument.h"
+
+#include "orion-math/matrix/batch.h"
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+#include <thread> // std::thread
+#include <vector> // std::vector
+
+namespace
+{
+    using orion::math::instrument::Counter;
+
+    class Instrument : public ::testing::Test
+    {
+    protected:
+        void SetUp() override { orion::math::instrument::reset(); }
+    };
+
+    TEST_F(Instrument, Enabled)
+    {
+        static_assert(orion::math::instrument::enabled);
+    }
+
+    TEST_F(Instrument, CountsOperations)
+    {
+        const orion::math::Vector3 vector{1, 2, 3};
+        const auto matrix = orion::math::scaling(1.f, 2.f, 3.f) * orion::math::rotation_x(orion::math::Degrees{30});
+        (void)orion::math::transform(vector, matrix);
+        (void)vector.normalized();
+
+        const auto snapshot = orion::math::instrument::snapshot();
+        // scaling * rotation, transform() applies the matrix without a matrix product
+        EXPECT_EQ(snapshot.count(Counter::matrix_multiply), 1);
+        EXPECT_EQ(snapshot.count(Counter::transform), 1);
+        EXPECT_EQ(snapshot.count(Counter::normalize), 1);
+        EXPECT_EQ(snapshot.count(Counter::sin), 1);
+        EXPECT_EQ(snapshot.count(Counter::cos), 1);
+        EXPECT_EQ(snapshot.count(Counter::sqrt), 1);
+        EXPECT_GT(snapshot.count(Counter::sqrt_iteration), 0);
+    }
+
+    TEST_F(Instrument, ConstantEvaluationIsNotCounted)
+    {
+        constexpr auto root = orion::math::sqrt(2.0);
+        (void)root;
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::sqrt), 0);
+    }
+
+    TEST_F(Instrument, BatchKernels)
+    {
+        const std::vector<orion::math::Matrix4> matrices(4096, orion::math::Matrix4::identity());
+        std::vector<orion::math::Matrix4> result(matrices.size());
+        EXPECT_EQ(orion::math::instrument::snapshot().elapsed_ns(Counter::batch_call), 0);
+        orion::math::batch_multiply(matrices, matrices, result);
+
+        const auto snapshot = orion::math::instrument::snapshot();
+        EXPECT_EQ(snapshot.count(Counter::batch_call), 1);
+        EXPECT_EQ(snapshot.count(Counter::batch_element), matrices.size());
+        EXPECT_EQ(snapshot.count(Counter::matrix_multiply), 0);
+        // The test target enables ORION_MATH_INSTRUMENT_TIMING
+        EXPECT_GT(snapshot.elapsed_ns(Counter::batch_call), 0);
+        EXPECT_EQ(snapshot.elapsed_ns(Counter::batch_element), 0);
+    }
+
+    TEST_F(Instrument, BatchMacroIsOneStatement)
+    {
+        const auto count_batch = [](bool enabled) {
+            if (enabled)
+                ORION_MATH_INSTRUMENT_BATCH(5);
+        };
+        count_batch(false);
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::batch_call), 0);
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::batch_element), 0);
+        count_batch(true);
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::batch_call), 1);
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::batch_element), 5);
+    }
+
+    TEST_F(Instrument, PerThread)
+    {
+        std::thread{[] { (void)orion::math::sqrt(2.0); }}.join();
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::sqrt), 0);
+
+        (void)orion::math::sqrt(2.0);
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::sqrt), 1);
+
+        orion::math::instrument::reset();
+        EXPECT_EQ(orion::math::instrument::snapshot().count(Counter::sqrt), 0);
+    }
+} // namespace
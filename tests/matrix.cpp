@@ -150,4 +150,41 @@ namespace
         const result_matrix expected{1, 5, 2, 6, 3, 7, 4, 8};
         EXPECT_EQ(transposed, expected);
     }
+
+    TEST(Matrix, VectorTimesMatrix)
+    {
+        using Matrix = orion::math::Matrix<int, 2, 3>;
+        const Matrix matrix{1, 2, 3, 4, 5, 6};
+        constexpr orion::math::Vector<int, 2> vector{1, 2};
+        const orion::math::Vector<int, 3> expected{9, 12, 15};
+        EXPECT_EQ(vector * matrix, expected);
+    }
+
+    TEST(Matrix, MatrixTimesVector)
+    {
+        using Matrix = orion::math::Matrix<int, 2, 3>;
+        constexpr Matrix matrix{1, 2, 3, 4, 5, 6};
+        constexpr orion::math::Vector<int, 3> vector{1, 0, -1};
+        constexpr auto product = matrix * vector;
+        static_assert(product == orion::math::Vector<int, 2>{-2, -2});
+    }
+
+    TEST(Matrix, VectorProductMatchesMatrixProduct)
+    {
+        using Matrix = orion::math::Matrix<double, 5, 5>;
+        Matrix matrix{};
+        orion::math::Matrix<double, 1, 5> row{};
+        orion::math::Vector<double, 5> vector{};
+        for (std::size_t i = 0; i < 5; ++i) {
+            vector[i] = row[0][i] = static_cast<double>(i) - 1.5;
+            for (std::size_t j = 0; j < 5; ++j) {
+                matrix[i][j] = static_cast<double>(i * 5 + j);
+            }
+        }
+        const auto product = vector * matrix;
+        const auto expected = row * matrix;
+        for (std::size_t j = 0; j < 5; ++j) {
+            EXPECT_DOUBLE_EQ(product[j], expected[0][j]);
+        }
+    }
 } // namespace
@@ -0,0 +1,233 @@
+#include "orion-math/noise/noise.h"
+
+#include <cmath>     // std::abs
+#include <gtest/gtest.h>
+#include <limits>    // std::numeric_limits
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <span>      // std::span
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using orion::math::NoiseType;
+
+    constexpr float max_coordinate = 50.f;
+
+    template<typename Vector>
+    std::vector<Vector> random_points(std::size_t count)
+    {
+        std::mt19937 generator{7};
+        std::uniform_real_distribution<float> distribution{-max_coordinate, max_coordinate};
+        std::vector<Vector> points(count);
+        for (auto& point : points) {
+            for (std::size_t i = 0; i < point.size(); ++i) {
+                point[i] = distribution(generator);
+            }
+        }
+        return points;
+    }
+
+    template<NoiseType Type, typename Vector>
+    void expect_bounded_and_varied(std::size_t count)
+    {
+        const auto points = random_points<Vector>(count);
+        float min = 1.f;
+        float max = -1.f;
+        for (const auto& point : points) {
+            const auto value = orion::math::noise<Type>(point);
+            ASSERT_LE(std::abs(value), 1.05f);
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
+        EXPECT_LT(min, -.3f);
+        EXPECT_GT(max, .3f);
+    }
+
+    TEST(Noise, Bounded)
+    {
+        expect_bounded_and_varied<NoiseType::perlin, orion::math::Vector2>(4096);
+        expect_bounded_and_varied<NoiseType::perlin, orion::math::Vector3>(4096);
+        expect_bounded_and_varied<NoiseType::perlin, orion::math::Vector4>(4096);
+        expect_bounded_and_varied<NoiseType::simplex, orion::math::Vector2>(4096);
+        expect_bounded_and_varied<NoiseType::simplex, orion::math::Vector3>(4096);
+        expect_bounded_and_varied<NoiseType::simplex, orion::math::Vector4>(4096);
+    }
+
+    TEST(Noise, PerlinVanishesOnLattice)
+    {
+        EXPECT_EQ(orion::math::perlin(orion::math::Vector2{3, -7}), 0);
+        EXPECT_EQ(orion::math::perlin(orion::math::Vector3{-2, 5, 11}), 0);
+        EXPECT_EQ(orion::math::perlin(orion::math::Vector4{1, 0, -4, 9}), 0);
+    }
+
+    TEST(Noise, Constexpr)
+    {
+        constexpr auto value = orion::math::simplex(orion::math::Vector3{.3f, 1.7f, -2.2f});
+        EXPECT_EQ(value, orion::math::simplex(orion::math::Vector3{.3f, 1.7f, -2.2f}));
+    }
+
+    TEST(Noise, Continuous)
+    {
+        const orion::math::Vector3 point{1.3f, -.7f, 4.1f};
+        const orion::math::Vector3 offset{1e-4f, 1e-4f, 1e-4f};
+        EXPECT_NEAR(orion::math::perlin(point), orion::math::perlin(point + offset), 1e-3);
+        EXPECT_NEAR(orion::math::simplex(point), orion::math::simplex(point + offset), 1e-3);
+    }
+
+    TEST(Noise, SeedChangesPattern)
+    {
+        const orion::math::Vector2 point{.4f, .6f};
+        EXPECT_NE(orion::math::simplex(point, 1), orion::math::simplex(point, 2));
+        EXPECT_EQ(orion::math::simplex(point, 1), orion::math::simplex(point, 1));
+    }
+
+    // Batches run the WideVector overloads, where the compiler may contract
+    // different multiply-adds than in the scalar code. Each contraction drops
+    // one rounding; the largest values rounded are the skewed lattice
+    // coordinates, below dimensions * (1 + max|p|), so lattice offsets agree to
+    // a few ulps of that. The noise slope stays below 8 per axis.
+    template<typename T>
+    double batch_tolerance(std::size_t dimensions, double max_abs_coordinate = max_coordinate)
+    {
+        return 32. * static_cast<double>(dimensions) * (1. + max_abs_coordinate) * std::numeric_limits<T>::epsilon();
+    }
+
+    template<typename T, std::size_t N, std::size_t lanes>
+    void expect_wide_matches_scalar()
+    {
+        using Wide = orion::math::WideVector<T, N, lanes>;
+        const auto points = random_points<orion::math::Vector<T, N>>(lanes * 64);
+        for (std::size_t i = 0; i < points.size(); i += lanes) {
+            const auto wide = Wide::load(std::span{points}.subspan(i, lanes));
+            const auto perlin = orion::math::perlin(wide, 5);
+            const auto simplex = orion::math::simplex(wide, 5);
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                ASSERT_NEAR(perlin[lane], orion::math::perlin(points[i + lane], 5), batch_tolerance<T>(N)) << N << "D perlin at " << i + lane;
+                ASSERT_NEAR(simplex[lane], orion::math::simplex(points[i + lane], 5), batch_tolerance<T>(N)) << N << "D simplex at " << i + lane;
+            }
+        }
+    }
+
+    TEST(Noise, WideMatchesScalar)
+    {
+        // Native or generic packs depending on the target
+        expect_wide_matches_scalar<float, 2, 4>();
+        expect_wide_matches_scalar<float, 3, 8>();
+        expect_wide_matches_scalar<float, 4, 4>();
+        expect_wide_matches_scalar<float, 4, 8>();
+        expect_wide_matches_scalar<double, 2, 4>();
+        expect_wide_matches_scalar<double, 3, 4>();
+        expect_wide_matches_scalar<double, 4, 8>();
+    }
+
+    TEST(Noise, BatchMatchesScalar)
+    {
+        const auto points = random_points<orion::math::Vector3>(3001);
+        std::vector<float> result(points.size());
+        orion::math::noise<NoiseType::simplex>(points, result, 9, 4);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            ASSERT_NEAR(result[i], orion::math::simplex(points[i], 9), batch_tolerance<float>(3)) << "at " << i;
+        }
+
+        const auto points4 = random_points<orion::math::Vector4>(37);
+        std::vector<float> result4(points4.size());
+        orion::math::noise<NoiseType::perlin>(points4, result4);
+        for (std::size_t i = 0; i < points4.size(); ++i) {
+            ASSERT_NEAR(result4[i], orion::math::perlin(points4[i]), batch_tolerance<float>(4));
+        }
+
+        EXPECT_THROW(orion::math::noise<NoiseType::perlin>(points, std::span<float>{result}.first(3)), std::invalid_argument);
+    }
+
+    template<NoiseType Type, typename Vector>
+    std::vector<float> batch_noise(const std::vector<Vector>& points, unsigned thread_count)
+    {
+        std::vector<float> result(points.size());
+        orion::math::noise<Type>(points, result, 9, thread_count);
+        return result;
+    }
+
+    TEST(Noise, BatchIndependentOfChunking)
+    {
+        // Chunk boundaries move with the thread count and the sizes leave partial packs
+        const auto points3 = random_points<orion::math::Vector3>(1003);
+        const auto points4 = random_points<orion::math::Vector4>(5003);
+        const auto simplex3 = batch_noise<NoiseType::simplex>(points3, 1);
+        const auto simplex4 = batch_noise<NoiseType::simplex>(points4, 1);
+        const auto perlin4 = batch_noise<NoiseType::perlin>(points4, 1);
+        for (const unsigned thread_count : {2U, 3U, 7U}) {
+            EXPECT_EQ(batch_noise<NoiseType::simplex>(points3, thread_count), simplex3) << thread_count << " threads";
+            EXPECT_EQ(batch_noise<NoiseType::simplex>(points4, thread_count), simplex4) << thread_count << " threads";
+            EXPECT_EQ(batch_noise<NoiseType::perlin>(points4, thread_count), perlin4) << thread_count << " threads";
+        }
+
+        // Every sample is the one the lane overload gives for it
+        constexpr auto lanes = orion::math::noise_batch_lanes<float>;
+        if constexpr (lanes > 1) {
+            for (std::size_t i = 0; i + lanes <= points4.size(); i += lanes) {
+                const auto wide = orion::math::simplex(orion::math::WideVector<float, 4, lanes>::load(std::span{points4}.subspan(i, lanes)), 9);
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    ASSERT_EQ(simplex4[i + lane], wide[lane]) << "at " << i + lane;
+                }
+            }
+        }
+
+        constexpr std::size_t width = 37;
+        constexpr std::size_t height = 11;
+        const orion::math::FbmSettings<float> settings{3};
+        std::vector<float> grid(width * height);
+        std::vector<float> threaded_grid(width * height);
+        orion::math::noise_grid<NoiseType::simplex>(orion::math::Vector2{-3.f, 1.f}, orion::math::Vector2{.3f, .2f}, width, height, grid, settings);
+        orion::math::noise_grid<NoiseType::simplex>(orion::math::Vector2{-3.f, 1.f}, orion::math::Vector2{.3f, .2f}, width, height, threaded_grid, settings, 0, 5);
+        EXPECT_EQ(threaded_grid, grid);
+    }
+
+    TEST(Noise, Fbm)
+    {
+        const orion::math::Vector2 point{2.3f, 5.1f};
+        const orion::math::FbmSettings<float> single{1};
+        EXPECT_EQ(orion::math::fbm<NoiseType::perlin>(point, single), orion::math::perlin(point));
+
+        const orion::math::FbmSettings<float> settings{4, 2.f, .5f};
+        const auto expected = (orion::math::perlin(point, 0) +
+                               .5f * orion::math::perlin(point * 2.f, 1) +
+                               .25f * orion::math::perlin(point * 4.f, 2) +
+                               .125f * orion::math::perlin(point * 8.f, 3)) /
+                              1.875f;
+        EXPECT_NEAR(orion::math::fbm<NoiseType::perlin>(point, settings), expected, 1e-6);
+
+        const auto points = random_points<orion::math::Vector2>(100);
+        std::vector<float> result(points.size());
+        orion::math::fbm<NoiseType::simplex>(points, result, settings, 3);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            // The last octave samples at eight times the coordinates
+            ASSERT_NEAR(result[i], orion::math::fbm<NoiseType::simplex>(points[i], settings, 3), batch_tolerance<float>(2, max_coordinate * 8));
+        }
+    }
+
+    TEST(Noise, Grid)
+    {
+        constexpr std::size_t width = 13;
+        constexpr std::size_t height = 5;
+        constexpr std::size_t depth = 3;
+        const orion::math::Vector3 origin{-1.f, 2.f, .5f};
+        const orion::math::Vector3 spacing{.25f, .5f, .125f};
+        std::vector<float> grid(width * height * depth);
+        orion::math::noise_grid<NoiseType::simplex>(origin, spacing, width, height, depth, grid);
+        for (std::size_t z = 0; z < depth; ++z) {
+            for (std::size_t y = 0; y < height; ++y) {
+                for (std::size_t x = 0; x < width; ++x) {
+                    const orion::math::Vector3 point{origin[0] + static_cast<float>(x) * spacing[0], origin[1] + static_cast<float>(y) * spacing[1], origin[2] + static_cast<float>(z) * spacing[2]};
+                    ASSERT_NEAR(grid[(z * height + y) * width + x], orion::math::simplex(point), batch_tolerance<float>(3, 4));
+                }
+            }
+        }
+
+        const orion::math::FbmSettings<float> settings{3};
+        std::vector<float> grid2(width * height);
+        orion::math::noise_grid<NoiseType::perlin>(orion::math::Vector2{0, 0}, orion::math::Vector2{.1f, .1f}, width, height, grid2, settings);
+        EXPECT_NEAR(grid2[width + 2], orion::math::fbm<NoiseType::perlin>(orion::math::Vector2{.2f, .1f}, settings), batch_tolerance<float>(2, 4));
+        EXPECT_THROW(orion::math::noise_grid<NoiseType::perlin>(orion::math::Vector2{0, 0}, orion::math::Vector2{1, 1}, width, height + 1, grid2), std::invalid_argument);
+    }
+} // namespace
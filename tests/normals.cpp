@@ -0,0 +1,143 @@
+#include "orion-math/mesh/normals.h"
+
+#include <cmath>     // std::abs, std::sin, std::cos, std::sqrt
+#include <cstdint>   // std::uint32_t
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument, std::out_of_range
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-5;
+
+    void expect_vector_near(const orion::math::Vector3& actual, const orion::math::Vector3& expected)
+    {
+        EXPECT_NEAR(actual.x(), expected.x(), acceptable_error);
+        EXPECT_NEAR(actual.y(), expected.y(), acceptable_error);
+        EXPECT_NEAR(actual.z(), expected.z(), acceptable_error);
+    }
+
+    // Unit quad in the xy plane facing +z, with uvs equal to the positions
+    const std::vector<orion::math::Vector3> quad_positions{{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    const std::vector<orion::math::Vector2> quad_uvs{{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    const std::vector<std::uint32_t> quad_indices{0, 1, 2, 0, 2, 3};
+
+    TEST(Normals, FlatQuad)
+    {
+        std::vector<orion::math::Vector3> normals(quad_positions.size());
+        orion::math::compute_normals(quad_positions, quad_indices, normals);
+        for (const auto& normal : normals) {
+            expect_vector_near(normal, {0, 0, 1});
+        }
+    }
+
+    TEST(Normals, AreaWeighted)
+    {
+        // Vertex 0 is shared by a large triangle facing +z and a small one facing +x
+        const std::vector<orion::math::Vector3> positions{{0, 0, 0}, {2, 0, 0}, {0, 2, 0}, {0, 1, 0}, {0, 0, 1}, {3, 3, 3}};
+        const std::vector<std::uint32_t> indices{0, 1, 2, 0, 3, 4};
+        std::vector<orion::math::Vector3> normals(positions.size());
+        orion::math::compute_normals(positions, indices, normals);
+
+        // Twice the areas are 4 and 1
+        const auto length = std::sqrt(17.f);
+        expect_vector_near(normals[0], {1 / length, 0, 4 / length});
+        expect_vector_near(normals[1], {0, 0, 1});
+        expect_vector_near(normals[3], {1, 0, 0});
+        expect_vector_near(normals[5], {0, 0, 0});
+    }
+
+    TEST(Normals, Threaded)
+    {
+        constexpr std::uint32_t size = 64;
+        std::vector<orion::math::Vector3> positions;
+        for (std::uint32_t y = 0; y < size; ++y) {
+            for (std::uint32_t x = 0; x < size; ++x) {
+                const auto fx = static_cast<float>(x);
+                const auto fy = static_cast<float>(y);
+                positions.push_back({fx, fy, std::sin(fx * .3f) * std::cos(fy * .2f)});
+            }
+        }
+        std::vector<std::uint32_t> indices;
+        for (std::uint32_t y = 0; y + 1 < size; ++y) {
+            for (std::uint32_t x = 0; x + 1 < size; ++x) {
+                const auto corner = y * size + x;
+                indices.insert(indices.end(), {corner, corner + 1, corner + size + 1, corner, corner + size + 1, corner + size});
+            }
+        }
+
+        std::vector<orion::math::Vector3> single_threaded(positions.size());
+        std::vector<orion::math::Vector3> multi_threaded(positions.size());
+        orion::math::compute_normals(positions, indices, single_threaded);
+        orion::math::compute_normals(positions, indices, multi_threaded, 4);
+        EXPECT_EQ(single_threaded, multi_threaded);
+        for (const auto& normal : single_threaded) {
+            EXPECT_NEAR(normal.sqr_magnitude(), 1, acceptable_error);
+            EXPECT_GT(normal.z(), 0);
+        }
+    }
+
+    TEST(Normals, InvalidIndices)
+    {
+        std::vector<orion::math::Vector3> normals(quad_positions.size());
+        const std::vector<std::uint32_t> out_of_range{0, 1, 4};
+        const std::vector<std::uint32_t> incomplete{0, 1};
+        EXPECT_THROW(orion::math::compute_normals(quad_positions, out_of_range, normals), std::out_of_range);
+        EXPECT_THROW(orion::math::compute_normals(quad_positions, incomplete, normals), std::invalid_argument);
+    }
+
+    TEST(Tangents, FollowTextureAxes)
+    {
+        const std::vector<orion::math::Vector3> normals(quad_positions.size(), {0, 0, 1});
+        std::vector<orion::math::Vector4> tangents(quad_positions.size());
+        orion::math::compute_angle_weighted_tangents(quad_positions, normals, quad_uvs, quad_indices, tangents);
+        for (const auto& tangent : tangents) {
+            EXPECT_NEAR(tangent.x(), 1, acceptable_error);
+            EXPECT_NEAR(tangent.y(), 0, acceptable_error);
+            EXPECT_NEAR(tangent.z(), 0, acceptable_error);
+            EXPECT_EQ(tangent.w(), 1);
+        }
+    }
+
+    TEST(Tangents, MirroredUvs)
+    {
+        const std::vector<orion::math::Vector3> normals(quad_positions.size(), {0, 0, 1});
+        const std::vector<orion::math::Vector2> mirrored{{1, 0}, {0, 0}, {0, 1}, {1, 1}};
+        std::vector<orion::math::Vector4> tangents(quad_positions.size());
+        orion::math::compute_angle_weighted_tangents(quad_positions, normals, mirrored, quad_indices, tangents);
+        for (const auto& tangent : tangents) {
+            EXPECT_NEAR(tangent.x(), -1, acceptable_error);
+            EXPECT_EQ(tangent.w(), -1);
+            // The reconstructed bitangent still follows +v
+            const orion::math::Vector3 direction{tangent.x(), tangent.y(), tangent.z()};
+            expect_vector_near(orion::math::cross(orion::math::Vector3{0, 0, 1}, direction) * tangent.w(), {0, 1, 0});
+        }
+    }
+
+    TEST(Tangents, SharedVerticesAreNotSplit)
+    {
+        // The first triangle is mirrored in u, the second is not. Vertices 1
+        // and 3 each belong to one of them, 0 and 2 get one handedness for both.
+        const std::vector<orion::math::Vector3> normals(quad_positions.size(), {0, 0, 1});
+        const std::vector<orion::math::Vector2> uvs{{0, 0}, {-1, 0}, {1, 1}, {0, 1}};
+        std::vector<orion::math::Vector4> tangents(quad_positions.size());
+        orion::math::compute_angle_weighted_tangents(quad_positions, normals, uvs, quad_indices, tangents);
+        EXPECT_EQ(tangents[1].w(), -1);
+        EXPECT_EQ(tangents[3].w(), 1);
+        EXPECT_EQ(std::abs(tangents[0].w()), 1);
+        EXPECT_EQ(std::abs(tangents[2].w()), 1);
+    }
+
+    TEST(Tangents, OrthogonalToNormal)
+    {
+        // Tilted normals still get tangents in their own plane
+        const std::vector<orion::math::Vector3> normals(quad_positions.size(), orion::math::Vector3{1, 0, 1}.normalized());
+        std::vector<orion::math::Vector4> tangents(quad_positions.size());
+        orion::math::compute_angle_weighted_tangents(quad_positions, normals, quad_uvs, quad_indices, tangents);
+        for (std::size_t i = 0; i < tangents.size(); ++i) {
+            const orion::math::Vector3 direction{tangents[i].x(), tangents[i].y(), tangents[i].z()};
+            EXPECT_NEAR(orion::math::dot(direction, normals[i]), 0, acceptable_error);
+            EXPECT_NEAR(direction.sqr_magnitude(), 1, acceptable_error);
+        }
+    }
+} // namespace
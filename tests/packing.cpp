@@ -0,0 +1,165 @@
+#include "orion-math/vector/packing.h"
+
+#include "orion-math/vector/formatter.h"
+
+#include <cmath>    // std::isnan, std::isinf
+#include <gtest/gtest.h>
+#include <limits>   // std::numeric_limits
+#include <vector>   // std::vector
+
+namespace
+{
+    TEST(Half, ExactValues)
+    {
+        static_assert(orion::math::half{1.f}.bits() == 0x3c00);
+        static_assert(orion::math::half{-2.f}.bits() == 0xc000);
+        static_assert(static_cast<float>(orion::math::half::from_bits(0x3555)) == 0.333251953125f);
+        EXPECT_EQ(orion::math::half{0.5f}.bits(), 0x3800);
+        EXPECT_EQ(static_cast<float>(orion::math::half{65504.f}), 65504.f);
+    }
+
+    TEST(Half, Rounding)
+    {
+        // 1 + 2^-11 lies exactly between two halves and rounds to even
+        EXPECT_EQ(orion::math::half{1.00048828125f}.bits(), 0x3c00);
+        EXPECT_EQ(orion::math::half{1.00146484375f}.bits(), 0x3c02);
+    }
+
+    TEST(Half, Subnormals)
+    {
+        constexpr auto smallest = 5.960464477539063e-8f;
+        EXPECT_EQ(orion::math::half{smallest}.bits(), 0x0001);
+        EXPECT_EQ(static_cast<float>(orion::math::half::from_bits(0x0001)), smallest);
+        EXPECT_EQ(orion::math::half{1e-10f}.bits(), 0x0000);
+    }
+
+    TEST(Half, SpecialValues)
+    {
+        EXPECT_TRUE(std::isinf(static_cast<float>(orion::math::half{1e6f})));
+        EXPECT_TRUE(std::isinf(static_cast<float>(orion::math::half{std::numeric_limits<float>::infinity()})));
+        EXPECT_TRUE(std::isnan(static_cast<float>(orion::math::half{std::numeric_limits<float>::quiet_NaN()})));
+    }
+
+    TEST(Half, VectorComponent)
+    {
+        const orion::math::Vector3_h vector{orion::math::half{1.f}, orion::math::half{2.f}, orion::math::half{2.f}};
+        EXPECT_EQ(static_cast<float>(vector.sqr_magnitude()), 9.f);
+        EXPECT_EQ(fmt::format("{}", vector), "Vector3(1, 2, 2)");
+    }
+
+    TEST(Packing, BulkHalf)
+    {
+        std::vector<orion::math::Vector4_f> floats(5);
+        for (std::size_t i = 0; i < floats.size(); ++i) {
+            const auto value = static_cast<float>(i);
+            floats[i] = {value, value + .5f, -value, value * .25f};
+        }
+        std::vector<orion::math::Vector4_h> halves(floats.size());
+        std::vector<orion::math::Vector4_f> unpacked(floats.size());
+
+        orion::math::pack_half(floats, halves);
+        orion::math::unpack_half(halves, unpacked);
+
+        EXPECT_EQ(unpacked, floats);
+        EXPECT_EQ(halves[3], orion::math::pack_half(floats[3]));
+    }
+
+    TEST(Packing, BulkHalfEmpty)
+    {
+        // Empty vectors have no storage, data() is null
+        std::vector<orion::math::Vector3_f> floats;
+        std::vector<orion::math::Vector3_h> halves;
+        orion::math::pack_half(floats, halves);
+        orion::math::unpack_half(halves, floats);
+
+        std::vector<orion::math::Vector4_f> floats4;
+        std::vector<orion::math::Vector4_h> halves4;
+        orion::math::pack_half(floats4, halves4);
+        orion::math::unpack_half(halves4, floats4);
+        EXPECT_TRUE(floats.empty() && floats4.empty());
+    }
+
+    TEST(Packing, Unorm)
+    {
+        const orion::math::Vector4_f color{0.f, .5f, 1.f, 2.f};
+        const auto packed = orion::math::pack_unorm<std::uint8_t>(color);
+        const orion::math::Vector<std::uint8_t, 4> expected{0, 128, 255, 255};
+        EXPECT_EQ(packed, expected);
+        EXPECT_NEAR(orion::math::unpack_unorm(packed)[1], .5f, 1.f / 255);
+    }
+
+    TEST(Packing, Snorm)
+    {
+        const orion::math::Vector3_f vector{-1.f, 0.f, .5f};
+        const auto packed = orion::math::pack_snorm<std::int16_t>(vector);
+        const orion::math::Vector<std::int16_t, 3> expected{-32767, 0, 16384};
+        EXPECT_EQ(packed, expected);
+        const orion::math::Vector<std::int8_t, 1> most_negative{-128};
+        EXPECT_EQ(orion::math::unpack_snorm(most_negative)[0], -1.f);
+    }
+
+    TEST(Packing, Octahedral)
+    {
+        const std::vector<orion::math::Vector3_f> normals{
+            {0.f, 0.f, 1.f},
+            {0.f, 0.f, -1.f},
+            {1.f, 0.f, 0.f},
+            {0.f, -1.f, 0.f},
+            orion::math::Vector3_f{1.f, -2.f, -3.f} / std::sqrt(14.f)};
+        std::vector<orion::math::OctahedralNormal> encoded(normals.size());
+        std::vector<orion::math::Vector3_f> decoded(normals.size());
+
+        orion::math::encode_octahedral(normals, encoded);
+        orion::math::decode_octahedral(encoded, decoded);
+
+        for (std::size_t i = 0; i < normals.size(); ++i) {
+            EXPECT_NEAR(decoded[i].x(), normals[i].x(), 1e-4);
+            EXPECT_NEAR(decoded[i].y(), normals[i].y(), 1e-4);
+            EXPECT_NEAR(decoded[i].z(), normals[i].z(), 1e-4);
+        }
+    }
+
+    TEST(Packing, OctahedralZeroVector)
+    {
+        const orion::math::Vector3_f zero{};
+        const orion::math::Vector2_f expected{0.f, 0.f};
+        EXPECT_EQ(orion::math::encode_octahedral_f(zero), expected);
+        const orion::math::OctahedralNormal packed{0, 0};
+        EXPECT_EQ(orion::math::encode_octahedral(zero), packed);
+        const orion::math::Vector3_f up{0.f, 0.f, 1.f};
+        EXPECT_EQ(orion::math::decode_octahedral(packed), up);
+
+        const auto nan = std::numeric_limits<float>::quiet_NaN();
+        EXPECT_EQ(orion::math::pack_snorm<std::int16_t>(orion::math::Vector2_f{nan, 1.f}), (orion::math::Vector<std::int16_t, 2>{0, 32767}));
+        EXPECT_EQ(orion::math::pack_unorm<std::uint8_t>(orion::math::Vector2_f{nan, 1.f}), (orion::math::Vector<std::uint8_t, 2>{0, 255}));
+    }
+
+    TEST(Packing, SmallestThreeQuaternion)
+    {
+        const std::vector<orion::math::Vector4_f> rotations{
+            {0.f, 0.f, 0.f, 1.f},
+            {0.f, 0.f, 0.f, -1.f},
+            {1.f, 0.f, 0.f, 0.f},
+            orion::math::Vector4_f{.1f, -.7f, .3f, -.2f}.normalized(),
+            orion::math::Vector4_f{.5f, .5f, -.5f, .5f}};
+        for (const auto& rotation : rotations) {
+            const auto decoded = orion::math::unpack_quaternion(orion::math::pack_quaternion(rotation));
+            // q and -q are the same rotation
+            const auto sign = orion::math::dot(decoded, rotation) < 0.f ? -1.f : 1.f;
+            for (std::size_t i = 0; i < 4; ++i) {
+                EXPECT_NEAR(decoded[i] * sign, rotation[i], 1e-4);
+            }
+        }
+        static_assert(sizeof(orion::math::PackedQuaternion) == 6);
+    }
+
+    TEST(Packing, SmallestThreeQuaternionNaN)
+    {
+        const auto nan = std::numeric_limits<float>::quiet_NaN();
+        const auto decoded = orion::math::unpack_quaternion(orion::math::pack_quaternion(orion::math::Vector4_f{nan, 0.f, 0.f, 1.f}));
+        const orion::math::Vector4_f expected{0.f, 0.f, 0.f, 1.f};
+        for (std::size_t i = 0; i < 4; ++i) {
+            EXPECT_NEAR(decoded[i], expected[i], 1e-4);
+        }
+    }
+} // namespace
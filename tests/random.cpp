@@ -0,0 +1,151 @@
+#include "orion-math/random/random.h"
+
+#include <cmath>   // std::abs, std::sqrt
+#include <gtest/gtest.h>
+#include <numeric> // std::accumulate
+#include <vector>  // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-5;
+
+    TEST(Random, Reproducible)
+    {
+        orion::math::Xoshiro128x8 first{42, 3};
+        orion::math::Xoshiro128x8 second{42, 3};
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQ(first.next(), second.next());
+        }
+    }
+
+    TEST(Random, StreamsAndLanesDiffer)
+    {
+        orion::math::Xoshiro128x8 first{42, 0};
+        orion::math::Xoshiro128x8 second{42, 1};
+        orion::math::Xoshiro128x8 other_seed{43, 0};
+        const auto a = first.next();
+        const auto b = second.next();
+        const auto c = other_seed.next();
+        EXPECT_NE(a, b);
+        EXPECT_NE(a, c);
+        for (std::size_t lane = 1; lane < orion::math::Xoshiro128x8::lanes; ++lane) {
+            EXPECT_NE(a[lane], a[0]);
+        }
+    }
+
+    TEST(Random, SeedAndStreamAreNotInterchangeable)
+    {
+        EXPECT_NE(orion::math::Xoshiro128x8(3, 5).next(), orion::math::Xoshiro128x8(5, 3).next());
+        EXPECT_NE(orion::math::Xoshiro128x8(0, 0).next(), orion::math::Xoshiro128x8(7, 7).next());
+        // Block b of seed a must not repeat block a of seed b
+        EXPECT_NE(orion::math::Xoshiro128x8(1, 2).next(), orion::math::Xoshiro128x8(2, 1).next());
+    }
+
+    TEST(Random, UniformMean)
+    {
+        orion::math::Xoshiro128x8 generator{1};
+        double sum = 0;
+        constexpr int steps = 4096;
+        for (int i = 0; i < steps; ++i) {
+            for (const auto value : generator.uniform<float>()) {
+                ASSERT_GE(value, 0.f);
+                ASSERT_LT(value, 1.f);
+                sum += value;
+            }
+        }
+        EXPECT_NEAR(sum / (steps * orion::math::Xoshiro128x8::lanes), .5, .01);
+    }
+
+    TEST(Random, UniformBox)
+    {
+        orion::math::Xoshiro128x8 generator{7};
+        std::vector<orion::math::Vector3> points(1003);
+        const orion::math::Vector3 min{-1, 2, 10};
+        const orion::math::Vector3 max{1, 3, 20};
+        orion::math::uniform_box(generator, points, min, max);
+        orion::math::Vector3 mean{0, 0, 0};
+        for (const auto& point : points) {
+            for (std::size_t i = 0; i < 3; ++i) {
+                ASSERT_GE(point[i], min[i]);
+                ASSERT_LT(point[i], max[i]);
+            }
+            mean = mean + point / static_cast<float>(points.size());
+        }
+        EXPECT_NEAR(mean.x(), 0, .1);
+        EXPECT_NEAR(mean.y(), 2.5, .05);
+        EXPECT_NEAR(mean.z(), 15, .5);
+    }
+
+    TEST(Random, UnitDirections)
+    {
+        orion::math::Xoshiro128x8 generator{9};
+        std::vector<orion::math::Vector3> directions(4096);
+        orion::math::unit_directions(generator, directions);
+        orion::math::Vector3 mean{0, 0, 0};
+        for (const auto& direction : directions) {
+            ASSERT_NEAR(direction.sqr_magnitude(), 1, acceptable_error);
+            mean = mean + direction / static_cast<float>(directions.size());
+        }
+        EXPECT_LT(std::sqrt(mean.sqr_magnitude()), .05);
+
+        std::vector<orion::math::Vector2_d> circle(100);
+        orion::math::unit_directions<double>(generator, circle);
+        for (const auto& direction : circle) {
+            ASSERT_NEAR(direction.sqr_magnitude(), 1, 1e-7);
+        }
+    }
+
+    TEST(Random, PointsInsideVolumes)
+    {
+        orion::math::Xoshiro128x8 generator{11};
+        std::vector<orion::math::Vector2> disk(4096);
+        orion::math::points_in_disk(generator, disk);
+        std::size_t inner_disk = 0;
+        for (const auto& point : disk) {
+            ASSERT_LE(point.sqr_magnitude(), 1 + acceptable_error);
+            inner_disk += point.sqr_magnitude() < .25f ? 1 : 0;
+        }
+        // A quarter of the area lies within radius 0.5
+        EXPECT_NEAR(static_cast<double>(inner_disk) / disk.size(), .25, .03);
+
+        std::vector<orion::math::Vector3> ball(4096);
+        orion::math::points_in_sphere(generator, ball);
+        std::size_t inner_ball = 0;
+        for (const auto& point : ball) {
+            ASSERT_LE(point.sqr_magnitude(), 1 + acceptable_error);
+            inner_ball += point.sqr_magnitude() < .25f ? 1 : 0;
+        }
+        // An eighth of the volume lies within radius 0.5
+        EXPECT_NEAR(static_cast<double>(inner_ball) / ball.size(), .125, .02);
+    }
+
+    TEST(Random, CosineHemisphere)
+    {
+        orion::math::Xoshiro128x8 generator{13};
+        std::vector<orion::math::Vector3> directions(8192);
+        orion::math::cosine_hemisphere(generator, directions);
+        double mean_z = 0;
+        for (const auto& direction : directions) {
+            ASSERT_NEAR(direction.sqr_magnitude(), 1, acceptable_error);
+            ASSERT_GE(direction.z(), 0);
+            mean_z += direction.z();
+        }
+        // E[cos theta] under a cosine weighted distribution is 2/3
+        EXPECT_NEAR(mean_z / directions.size(), 2. / 3., .01);
+    }
+
+    TEST(Random, ParallelIndependentOfThreadCount)
+    {
+        auto fill = [](unsigned thread_count) {
+            std::vector<orion::math::Vector3> directions(3 * orion::math::random_block_size + 17);
+            orion::math::parallel_random(5, directions.size(), thread_count, [&](orion::math::Xoshiro128x8& generator, std::size_t begin, std::size_t end) {
+                orion::math::unit_directions(generator, std::span{directions}.subspan(begin, end - begin));
+            });
+            return directions;
+        };
+        const auto single = fill(1);
+        const auto multi = fill(4);
+        EXPECT_EQ(single, multi);
+        EXPECT_NE(single[0], single[orion::math::random_block_size]);
+    }
+} // namespace
@@ -0,0 +1,151 @@
+#include "orion-math/reduce/reduce.h"
+
+#include "orion-math/matrix/matrix3.h"
+#include "orion-math/vector/vector2.h"
+#include "orion-math/vector/vector3.h"
+
+#include <algorithm> // std::max
+#include <cmath>     // std::abs, std::sqrt
+#include <cstddef>   // std::size_t
+#include <gtest/gtest.h>
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    // A scan far from the origin, where float running totals lose most of their precision
+    std::vector<orion::math::Vector3> make_scan(std::size_t count)
+    {
+        std::mt19937 engine{42};
+        std::uniform_real_distribution<float> x{1000.f, 1010.f};
+        std::uniform_real_distribution<float> y{-5.f, 5.f};
+        std::uniform_real_distribution<float> z{200.f, 201.f};
+        std::vector<orion::math::Vector3> points(count);
+        for (auto& point : points) {
+            point = {x(engine), y(engine), z(engine)};
+        }
+        return points;
+    }
+
+    orion::math::Vector3_d reference_sum(const std::vector<orion::math::Vector3>& points)
+    {
+        orion::math::Vector3_d result{};
+        for (const auto& point : points) {
+            for (std::size_t i = 0; i < 3; ++i) {
+                result[i] += point[i];
+            }
+        }
+        return result;
+    }
+
+    TEST(Reduce, SumIsAccurate)
+    {
+        const auto points = make_scan(1'000'003);
+        const auto expected = reference_sum(points);
+        for (const unsigned threads : {1U, 3U, 0U}) {
+            const auto actual = orion::math::sum(points, threads);
+            for (std::size_t i = 0; i < 3; ++i) {
+                EXPECT_NEAR(actual[i], expected[i], std::abs(expected[i]) * 1e-6 + 1) << "component " << i << " with " << threads << " threads";
+            }
+        }
+    }
+
+    TEST(Reduce, SumSmallAndEmpty)
+    {
+        const std::vector<orion::math::Vector2> points{{1, 2}, {3, 4}, {5, 6}};
+        const orion::math::Vector2 expected{9, 12};
+        EXPECT_EQ((orion::math::sum<float, 2>(points)), expected);
+        EXPECT_EQ(orion::math::sum(std::vector<orion::math::Vector3>{}), orion::math::Vector3{});
+
+        const std::vector<orion::math::Vector3_i> integers{{1, 2, 3}, {-4, 5, 6}};
+        const orion::math::Vector3_i expected_integers{-3, 7, 9};
+        EXPECT_EQ(orion::math::sum<int>(integers), expected_integers);
+    }
+
+    TEST(Reduce, Mean)
+    {
+        const auto points = make_scan(100'000);
+        const auto expected = reference_sum(points) / static_cast<double>(points.size());
+        const auto actual = orion::math::mean(points, 4);
+        for (std::size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(actual[i], expected[i], 1e-3);
+        }
+        EXPECT_THROW((void)orion::math::mean(std::vector<orion::math::Vector3>{}), std::invalid_argument);
+    }
+
+    TEST(Reduce, Bounds)
+    {
+        auto points = make_scan(50'001);
+        points[123] = {900, 0, 200.5f};
+        points[40'000] = {1005, 7, 200.5f};
+        points.back() = {1005, 0, 250};
+        for (const unsigned threads : {1U, 4U}) {
+            const auto bounds = orion::math::bounds(points, threads);
+            EXPECT_EQ(bounds.min.x(), 900);
+            EXPECT_EQ(bounds.max.y(), 7);
+            EXPECT_EQ(bounds.max.z(), 250);
+            EXPECT_GE(bounds.min.y(), -5);
+            EXPECT_GE(bounds.min.z(), 200);
+            EXPECT_LE(bounds.max.x(), 1010);
+        }
+
+        const auto empty = orion::math::bounds(std::vector<orion::math::Vector3>{});
+        EXPECT_TRUE(empty.is_empty());
+        const std::vector<orion::math::Vector3> single{{1, 2, 3}};
+        EXPECT_EQ(merge(empty, orion::math::bounds(single)), orion::math::bounds(single));
+        EXPECT_FALSE(orion::math::bounds(single).is_empty());
+    }
+
+    TEST(Reduce, Covariance)
+    {
+        const auto points = make_scan(200'000);
+        const auto center = reference_sum(points) / static_cast<double>(points.size());
+        orion::math::Matrix3_d expected{};
+        for (const auto& point : points) {
+            for (std::size_t i = 0; i < 3; ++i) {
+                for (std::size_t j = 0; j < 3; ++j) {
+                    expected[i][j] += (point[i] - center[i]) * (point[j] - center[j]);
+                }
+            }
+        }
+
+        const auto actual = orion::math::covariance(points, 3);
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(actual[i][j], expected[i][j] / static_cast<double>(points.size()), 1e-3) << "at [" << i << "][" << j << "]";
+                EXPECT_EQ(actual[i][j], actual[j][i]);
+            }
+        }
+        // Uniform on [a, a + w] has variance w^2 / 12
+        EXPECT_NEAR(actual[0][0], 100.f / 12, 0.1);
+        EXPECT_NEAR(actual[2][2], 1.f / 12, 0.01);
+    }
+
+    TEST(Reduce, CovarianceOfLine)
+    {
+        const std::vector<orion::math::Vector2_d> points{{0, 0}, {1, 2}, {2, 4}, {3, 6}};
+        const auto actual = orion::math::covariance<double, 2>(points);
+        EXPECT_DOUBLE_EQ(actual[0][0], 1.25);
+        EXPECT_DOUBLE_EQ(actual[0][1], 2.5);
+        EXPECT_DOUBLE_EQ(actual[1][1], 5);
+    }
+
+    TEST(Reduce, MaxDistance)
+    {
+        auto points = make_scan(10'007);
+        const orion::math::Vector3 center{1005, 0, 200.5f};
+        points[9'000] = center + orion::math::Vector3{0, 30, 40};
+        for (const unsigned threads : {1U, 2U}) {
+            EXPECT_FLOAT_EQ(orion::math::max_distance(points, center, threads), 50);
+        }
+
+        points.resize(5);
+        auto expected = 0.f;
+        for (const auto& point : points) {
+            expected = std::max(expected, std::sqrt((point - center).sqr_magnitude()));
+        }
+        EXPECT_FLOAT_EQ(orion::math::max_distance(points, center), expected);
+        EXPECT_EQ(orion::math::max_distance(std::vector<orion::math::Vector3>{}, center), 0);
+    }
+} // namespace
@@ -0,0 +1,156 @@
+#include "orion-math/animation/skinning.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+#include <cstdint> // std::uint16_t
+#include <vector>  // std::vector
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-5;
+
+    TEST(Skinning, SingleBone)
+    {
+        const std::vector<orion::math::Matrix4> palette{
+            orion::math::Matrix4::identity(),
+            orion::math::rotation_z(orion::math::Degrees{90}) * orion::math::translation(1.f, 2.f, 3.f)};
+        const std::vector<orion::math::Vector3> positions{{1, 0, 0}, {0, 1, 0}};
+        const std::vector<orion::math::Vector3> normals{{1, 0, 0}, {0, 1, 0}};
+        const std::vector<orion::math::BoneIndices> bones{{1, 0, 0, 0}, {1, 0, 0, 0}};
+        const std::vector<orion::math::Vector4> weights{{1, 0, 0, 0}, {1, 0, 0, 0}};
+        std::vector<orion::math::Vector3> skinned_positions(positions.size());
+        std::vector<orion::math::Vector3> skinned_normals(normals.size());
+
+        orion::math::skin(positions, normals, bones, weights, palette, skinned_positions, skinned_normals);
+
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            const auto expected = orion::math::transform(positions[i], palette[1]);
+            EXPECT_NEAR(skinned_positions[i].x(), expected.x(), acceptable_error);
+            EXPECT_NEAR(skinned_positions[i].y(), expected.y(), acceptable_error);
+            EXPECT_NEAR(skinned_positions[i].z(), expected.z(), acceptable_error);
+        }
+        EXPECT_NEAR(skinned_normals[0].x(), 0, acceptable_error);
+        EXPECT_NEAR(skinned_normals[0].y(), 1, acceptable_error);
+        EXPECT_NEAR(skinned_normals[1].x(), -1, acceptable_error);
+        EXPECT_NEAR(skinned_normals[1].y(), 0, acceptable_error);
+    }
+
+    TEST(Skinning, BlendedBones)
+    {
+        const std::vector<orion::math::Matrix4> palette{
+            orion::math::translation(2.f, 0.f, 0.f),
+            orion::math::translation(0.f, 4.f, 0.f)};
+        const std::vector<orion::math::Vector3> positions{{1, 1, 1}};
+        const std::vector<orion::math::BoneIndices> bones{{0, 1, 0, 0}};
+        const std::vector<orion::math::Vector4> weights{{.5f, .5f, 0, 0}};
+        std::vector<orion::math::Vector3> skinned_positions(positions.size());
+
+        orion::math::skin(positions, {}, bones, weights, palette, skinned_positions, {});
+
+        const orion::math::Vector3 expected{2, 3, 1};
+        EXPECT_EQ(skinned_positions[0], expected);
+    }
+
+    TEST(Skinning, MatchesBlendedMatrix)
+    {
+        // An odd vertex count leaves a partial batch at the end
+        constexpr std::size_t vertex_count = 13;
+        const std::vector<orion::math::Matrix4> palette{
+            orion::math::translation(1.f, -2.f, .5f),
+            orion::math::rotation_x(orion::math::Degrees{30}),
+            orion::math::rotation_y(orion::math::Degrees{-45}) * orion::math::translation(0.f, 3.f, 0.f),
+            orion::math::rotation_z(orion::math::Degrees{60}) * orion::math::scaling(2.f, 2.f, 2.f)};
+        std::vector<orion::math::Vector3> positions(vertex_count);
+        std::vector<orion::math::Vector3> normals(vertex_count);
+        std::vector<orion::math::BoneIndices> bones(vertex_count);
+        std::vector<orion::math::Vector4> weights(vertex_count);
+        for (std::size_t i = 0; i < vertex_count; ++i) {
+            const auto value = static_cast<float>(i);
+            positions[i] = {value, 1.f - value, .5f * value};
+            normals[i] = orion::math::Vector3{1.f, value, -2.f}.normalized();
+            bones[i] = {static_cast<std::uint16_t>(i % 4), static_cast<std::uint16_t>((i + 1) % 4), static_cast<std::uint16_t>((i + 2) % 4), static_cast<std::uint16_t>((i + 3) % 4)};
+            const auto weight = value / vertex_count;
+            weights[i] = {.4f * weight, .3f, .3f * (1.f - weight), .4f - .1f * weight};
+        }
+        std::vector<orion::math::Vector3> skinned_positions(vertex_count);
+        std::vector<orion::math::Vector3> skinned_normals(vertex_count);
+
+        orion::math::skin(positions, normals, bones, weights, palette, skinned_positions, skinned_normals);
+
+        for (std::size_t i = 0; i < vertex_count; ++i) {
+            orion::math::Matrix4 blended{};
+            for (std::size_t influence = 0; influence < orion::math::max_bone_influences; ++influence) {
+                blended = blended + weights[i][influence] * palette[bones[i][influence]];
+            }
+            const auto expected_position = orion::math::transform_point(positions[i], blended);
+            const auto expected_normal = orion::math::transform_direction(normals[i], blended).normalized();
+            for (std::size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(skinned_positions[i][j], expected_position[j], acceptable_error * 10);
+                EXPECT_NEAR(skinned_normals[i][j], expected_normal[j], acceptable_error);
+            }
+        }
+    }
+
+    TEST(Skinning, Threaded)
+    {
+        // Enough vertices for four chunks, and not a multiple of the lane width so chunks end inside a batch
+        constexpr std::size_t vertex_count = 4 * orion::math::detail::skinning_min_chunk_size + 7;
+        const std::vector<orion::math::Matrix4> palette{
+            orion::math::translation(1.f, 0.f, 0.f),
+            orion::math::scaling(2.f, 2.f, 2.f)};
+        std::vector<orion::math::Vector3> positions(vertex_count);
+        std::vector<orion::math::BoneIndices> bones(vertex_count, {0, 1, 0, 0});
+        std::vector<orion::math::Vector4> weights(vertex_count);
+        for (std::size_t i = 0; i < vertex_count; ++i) {
+            const auto value = static_cast<float>(i) / vertex_count;
+            positions[i] = {value, -value, 1.f};
+            weights[i] = {value, 1.f - value, 0.f, 0.f};
+        }
+        std::vector<orion::math::Vector3> single_threaded(vertex_count);
+        std::vector<orion::math::Vector3> single_threaded_normals(vertex_count);
+        orion::math::skin(positions, positions, bones, weights, palette, single_threaded, single_threaded_normals);
+
+        for (const unsigned thread_count : {2U, 3U, 4U}) {
+            std::vector<orion::math::Vector3> multi_threaded(vertex_count);
+            std::vector<orion::math::Vector3> multi_threaded_normals(vertex_count);
+            orion::math::skin(positions, positions, bones, weights, palette, multi_threaded, multi_threaded_normals, thread_count);
+            EXPECT_EQ(single_threaded, multi_threaded);
+            EXPECT_EQ(single_threaded_normals, multi_threaded_normals);
+        }
+    }
+
+    TEST(Skinning, SizeMismatch)
+    {
+        const std::vector<orion::math::Matrix4> palette{orion::math::Matrix4::identity()};
+        const std::vector<orion::math::Vector3> positions(2);
+        const std::vector<orion::math::BoneIndices> bones(1);
+        const std::vector<orion::math::Vector4> weights(2);
+        std::vector<orion::math::Vector3> skinned_positions(2);
+        EXPECT_THROW(orion::math::skin(positions, {}, bones, weights, palette, skinned_positions, {}), std::invalid_argument);
+    }
+
+    TEST(Skinning, BoneIndexOutOfRange)
+    {
+        const std::vector<orion::math::Matrix4> palette(2, orion::math::Matrix4::identity());
+        const std::vector<orion::math::Vector3> positions{{1, 2, 3}, {4, 5, 6}};
+        const std::vector<orion::math::BoneIndices> bones{{0, 1, 0, 0}, {0, 0, 2, 0}};
+        const std::vector<orion::math::Vector4> weights{{1, 0, 0, 0}, {1, 0, 0, 0}};
+        std::vector<orion::math::Vector3> skinned_positions(2);
+        EXPECT_THROW(orion::math::skin(positions, {}, bones, weights, palette, skinned_positions, {}), std::invalid_argument);
+        EXPECT_EQ(skinned_positions[0], orion::math::Vector3{});
+    }
+
+    TEST(Skinning, ZeroLengthNormal)
+    {
+        const std::vector<orion::math::Matrix4> palette{orion::math::Matrix4::identity()};
+        const std::vector<orion::math::Vector3> positions(1);
+        const std::vector<orion::math::Vector3> normals(1);
+        const std::vector<orion::math::BoneIndices> bones(1);
+        const std::vector<orion::math::Vector4> weights{{1, 0, 0, 0}};
+        std::vector<orion::math::Vector3> skinned_positions(1);
+        std::vector<orion::math::Vector3> skinned_normals(1, orion::math::Vector3{1, 1, 1});
+        orion::math::skin(positions, normals, bones, weights, palette, skinned_positions, skinned_normals);
+        EXPECT_EQ(skinned_normals[0], orion::math::Vector3{});
+    }
+} // namespace
@@ -0,0 +1,149 @@
+#include "orion-math/matrix/solve.h"
+
+#include <gtest/gtest.h>
+#include <cstddef> // std::size_t
+#include <random>  // std::mt19937, std::uniform_real_distribution
+
+namespace
+{
+    constexpr auto acceptable_error = 1e-9;
+
+    template<std::size_t N>
+    orion::math::Matrix<double, N, N> random_matrix(std::mt19937& engine)
+    {
+        std::uniform_real_distribution<double> distribution{-1, 1};
+        orion::math::Matrix<double, N, N> result;
+        for (auto& row : result) {
+            for (auto& value : row) {
+                value = distribution(engine);
+            }
+        }
+        return result;
+    }
+
+    template<std::size_t N>
+    orion::math::Vector<double, N> random_vector(std::mt19937& engine)
+    {
+        std::uniform_real_distribution<double> distribution{-1, 1};
+        orion::math::Vector<double, N> result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = distribution(engine);
+        }
+        return result;
+    }
+
+    template<std::size_t N>
+    void expect_vector_near(const orion::math::Vector<double, N>& actual, const orion::math::Vector<double, N>& expected)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            EXPECT_NEAR(actual[i], expected[i], acceptable_error) << "at [" << i << "]";
+        }
+    }
+
+    template<std::size_t N>
+    void expect_solves_random_systems()
+    {
+        std::mt19937 engine{static_cast<unsigned>(N)};
+        for (int attempt = 0; attempt < 10; ++attempt) {
+            const auto matrix = random_matrix<N>(engine);
+            const auto b = random_vector<N>(engine);
+            const auto x = orion::math::solve(matrix, b);
+            ASSERT_TRUE(x.has_value());
+            expect_vector_near(matrix * *x, b);
+
+            // A * A^T + I is symmetric positive definite
+            const auto spd = matrix * matrix.transpose() + orion::math::Matrix<double, N, N>::identity();
+            const auto y = orion::math::solve_spd(spd, b);
+            ASSERT_TRUE(y.has_value());
+            expect_vector_near(spd * *y, b);
+            expect_vector_near(*y, *orion::math::solve(spd, b));
+        }
+    }
+
+    TEST(Solve, RandomSystems)
+    {
+        expect_solves_random_systems<1>();
+        expect_solves_random_systems<2>();
+        expect_solves_random_systems<3>();
+        expect_solves_random_systems<4>();
+        expect_solves_random_systems<6>();
+        expect_solves_random_systems<8>();
+        // Above max_unrolled_solve the same steps run as loops
+        expect_solves_random_systems<9>();
+        expect_solves_random_systems<12>();
+    }
+
+    TEST(Solve, NeedsPivoting)
+    {
+        const orion::math::Matrix<double, 3, 3> matrix{
+            0, 2, 1,
+            1, 0, 0,
+            3, 1, 0};
+        const orion::math::Vector<double, 3> b{5, 1, 5};
+        const auto x = orion::math::solve(matrix, b);
+        ASSERT_TRUE(x.has_value());
+        expect_vector_near(*x, orion::math::Vector<double, 3>{1, 2, 1});
+    }
+
+    TEST(Solve, Singular)
+    {
+        const orion::math::Matrix<double, 3, 3> matrix{
+            1, 2, 3,
+            2, 4, 6,
+            0, 1, 1};
+        EXPECT_FALSE(orion::math::solve(matrix, orion::math::Vector<double, 3>{1, 2, 3}).has_value());
+        EXPECT_FALSE(orion::math::lu_decompose(orion::math::Matrix<double, 4, 4>{}).has_value());
+        EXPECT_FALSE(orion::math::lu_decompose(orion::math::Matrix<double, 10, 10>{}).has_value());
+        EXPECT_FALSE(orion::math::cholesky_decompose(orion::math::Matrix<double, 10, 10>{}).has_value());
+    }
+
+    TEST(Solve, NotPositiveDefinite)
+    {
+        const orion::math::Matrix<double, 2, 2> indefinite{
+            1, 2,
+            2, 1};
+        EXPECT_FALSE(orion::math::solve_spd(indefinite, orion::math::Vector<double, 2>{1, 1}).has_value());
+        EXPECT_TRUE(orion::math::solve(indefinite, orion::math::Vector<double, 2>{1, 1}).has_value());
+    }
+
+    TEST(Solve, Cholesky)
+    {
+        const orion::math::Matrix<double, 3, 3> matrix{
+            4, 12, -16,
+            12, 37, -43,
+            -16, -43, 98};
+        const auto l = orion::math::cholesky_decompose(matrix);
+        ASSERT_TRUE(l.has_value());
+        const orion::math::Matrix<double, 3, 3> expected{
+            2, 0, 0,
+            6, 1, 0,
+            -8, 5, 3};
+        for (std::size_t i = 0; i < 3; ++i) {
+            expect_vector_near((*l)[i], expected[i]);
+        }
+    }
+
+    TEST(Solve, Determinant)
+    {
+        const orion::math::Matrix<double, 3, 3> matrix{
+            0, 2, 1,
+            1, 0, 0,
+            3, 1, 0};
+        EXPECT_NEAR(orion::math::lu_decompose(matrix)->determinant(), 1, acceptable_error);
+        EXPECT_NEAR(orion::math::lu_decompose(orion::math::Matrix<double, 5, 5>::identity() * 2.)->determinant(), 32, acceptable_error);
+    }
+
+    TEST(Solve, Constexpr)
+    {
+        constexpr orion::math::Matrix<double, 2, 2> matrix{
+            2, 1,
+            1, 3};
+        constexpr orion::math::Vector<double, 2> b{3, 5};
+        constexpr auto x = orion::math::solve(matrix, b);
+        static_assert(x.has_value());
+        static_assert(abs((*x)[0] - .8) < 1e-12 && abs((*x)[1] - 1.4) < 1e-12);
+        constexpr auto y = orion::math::solve_spd(matrix, b);
+        static_assert(abs((*y)[0] - .8) < 1e-12 && abs((*y)[1] - 1.4) < 1e-12);
+        static_assert(!orion::math::solve(orion::math::Matrix<double, 2, 2>{}, b).has_value());
+    }
+} // namespace
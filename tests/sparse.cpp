@@ -0,0 +1,168 @@
+#include "orion-math/sparse/conjugate_gradient.h"
+
+#include <algorithm> // std::ranges::equal
+#include <cmath>     // std::sqrt
+#include <cstdint>   // std::uint32_t
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument, std::out_of_range
+#include <vector>    // std::vector
+
+namespace
+{
+    // Tridiagonal 1D Poisson matrix with 2 on the diagonal and -1 beside it,
+    // shifted slightly to keep the condition number moderate
+    orion::math::SparseMatrix<double> poisson(std::uint32_t size)
+    {
+        std::vector<orion::math::Triplet<double>> triplets;
+        for (std::uint32_t i = 0; i < size; ++i) {
+            triplets.push_back({i, i, 2.01});
+            if (i > 0) {
+                triplets.push_back({i, i - 1, -1});
+                triplets.push_back({i - 1, i, -1});
+            }
+        }
+        return orion::math::SparseMatrix<double>::from_triplets(size, size, triplets);
+    }
+
+    template<typename Entry>
+    void expect_solves(const orion::math::CsrMatrix<Entry>& matrix, const std::vector<orion::math::csr_vector_t<Entry>>& b, const std::vector<orion::math::csr_vector_t<Entry>>& x)
+    {
+        std::vector<orion::math::csr_vector_t<Entry>> product(b.size());
+        orion::math::multiply(matrix, x, product);
+        double error = 0;
+        double norm = 0;
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            error += orion::math::detail::inner(product[i] - b[i], product[i] - b[i]);
+            norm += orion::math::detail::inner(b[i], b[i]);
+        }
+        EXPECT_LT(std::sqrt(error / norm), 1e-5);
+    }
+
+    TEST(Sparse, FromTriplets)
+    {
+        const std::vector<orion::math::Triplet<float>> triplets{{1, 2, 3}, {0, 0, 1}, {1, 0, 2}, {1, 2, 4}};
+        const auto matrix = orion::math::SparseMatrix<float>::from_triplets(2, 3, triplets);
+        EXPECT_EQ(matrix.nonzeros(), 3);
+        EXPECT_EQ(matrix(1, 2), 7);
+        EXPECT_EQ(matrix(1, 0), 2);
+        EXPECT_EQ(matrix(0, 1), 0);
+        const std::vector<std::uint32_t> expected_offsets{0, 1, 3};
+        EXPECT_TRUE(std::ranges::equal(matrix.row_offsets(), expected_offsets));
+    }
+
+    TEST(Sparse, InvalidInput)
+    {
+        const std::vector<orion::math::Triplet<float>> triplets{{2, 0, 1}};
+        EXPECT_THROW((void)orion::math::SparseMatrix<float>::from_triplets(2, 2, triplets), std::out_of_range);
+        EXPECT_THROW((orion::math::SparseMatrix<float>{2, 2, {0, 2, 2}, {1, 0}, {1, 1}}), std::invalid_argument);
+    }
+
+    TEST(Sparse, InteriorOffsetsOutOfRange)
+    {
+        // Only the first and last offsets are consistent, the middle one points far past the values
+        EXPECT_THROW((orion::math::SparseMatrix<float>{2, 5, {0, 100, 5}, {0, 1, 2, 3, 4}, {1, 1, 1, 1, 1}}), std::invalid_argument);
+        EXPECT_THROW((orion::math::SparseMatrix<float>{3, 5, {0, 4, 2, 5}, {0, 1, 2, 3, 4}, {1, 1, 1, 1, 1}}), std::invalid_argument);
+    }
+
+    TEST(Sparse, Multiply)
+    {
+        const auto matrix = poisson(2000);
+        std::vector<double> x(matrix.rows());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            x[i] = static_cast<double>(i % 7);
+        }
+        std::vector<double> single_threaded(x.size());
+        std::vector<double> multi_threaded(x.size());
+        orion::math::multiply(matrix, x, single_threaded);
+        orion::math::multiply(matrix, x, multi_threaded, 4);
+        EXPECT_EQ(single_threaded, multi_threaded);
+        EXPECT_DOUBLE_EQ(single_threaded[1], 2.01 * 1 - 0 - 2);
+    }
+
+    TEST(ConjugateGradient, Preconditioners)
+    {
+        const auto matrix = poisson(500);
+        const std::vector<double> b(matrix.rows(), 1);
+        for (const auto preconditioner : {orion::math::Preconditioner::none, orion::math::Preconditioner::jacobi, orion::math::Preconditioner::incomplete_cholesky}) {
+            std::vector<double> x(matrix.rows(), 0);
+            orion::math::ConjugateGradientSettings<double> settings;
+            settings.preconditioner = preconditioner;
+            settings.tolerance = 1e-8;
+            const auto result = orion::math::conjugate_gradient(matrix, b, x, settings);
+            EXPECT_TRUE(result.converged);
+            EXPECT_LE(result.relative_residual, 1e-8);
+            expect_solves(matrix, b, x);
+        }
+    }
+
+    TEST(ConjugateGradient, IncompleteCholeskyIsExactForTridiagonal)
+    {
+        // A tridiagonal factor has no fill-in, so IC(0) is the full Cholesky factor
+        const auto matrix = poisson(100);
+        const std::vector<double> b(matrix.rows(), 1);
+        std::vector<double> x(matrix.rows(), 0);
+        const auto result = orion::math::conjugate_gradient(matrix, b, x, {orion::math::Preconditioner::incomplete_cholesky, 1e-10});
+        EXPECT_LE(result.iterations, 2);
+    }
+
+    TEST(ConjugateGradient, Threaded)
+    {
+        const auto matrix = poisson(5000);
+        const std::vector<double> b(matrix.rows(), 1);
+        for (const auto preconditioner : {orion::math::Preconditioner::none, orion::math::Preconditioner::jacobi, orion::math::Preconditioner::incomplete_cholesky}) {
+            std::vector<double> single_threaded(matrix.rows(), 0);
+            std::vector<double> x(matrix.rows(), 0);
+            const auto expected = orion::math::conjugate_gradient(matrix, b, single_threaded, {preconditioner, 1e-8, 1000, 1});
+            const auto result = orion::math::conjugate_gradient(matrix, b, x, {preconditioner, 1e-8, 1000, 4});
+            EXPECT_TRUE(result.converged);
+            EXPECT_NEAR(static_cast<double>(result.iterations), static_cast<double>(expected.iterations), 2);
+            expect_solves(matrix, b, x);
+        }
+
+        const std::vector<double> zero(matrix.rows(), 0);
+        std::vector<double> x(matrix.rows(), 1);
+        const auto result = orion::math::conjugate_gradient(matrix, zero, x, {orion::math::Preconditioner::jacobi, 1e-8, 1000, 4});
+        EXPECT_TRUE(result.converged);
+        EXPECT_EQ(result.iterations, 0);
+        EXPECT_EQ(x, zero);
+    }
+
+    TEST(ConjugateGradient, Block3)
+    {
+        // A chain of particles coupled by isotropic springs plus anisotropic mass terms
+        constexpr std::uint32_t size = 200;
+        std::vector<orion::math::Triplet<orion::math::Matrix3_d>> triplets;
+        for (std::uint32_t i = 0; i < size; ++i) {
+            const orion::math::Matrix3_d mass{
+                3, .5, 0,
+                .5, 2.5, .2,
+                0, .2, 2.2};
+            triplets.push_back({i, i, mass});
+            if (i > 0) {
+                const auto coupling = orion::math::Matrix3_d::identity() * -1.0;
+                triplets.push_back({i, i - 1, coupling});
+                triplets.push_back({i - 1, i, coupling});
+            }
+        }
+        const auto matrix = orion::math::BlockSparseMatrix3<double>::from_triplets(size, size, triplets);
+        std::vector<orion::math::Vector3_d> b(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            b[i] = {1, static_cast<double>(i % 3), -1};
+        }
+        std::vector<orion::math::Vector3_d> x(size);
+        const auto result = orion::math::conjugate_gradient(matrix, b, x, {orion::math::Preconditioner::jacobi, 1e-8});
+        EXPECT_TRUE(result.converged);
+        expect_solves(matrix, b, x);
+
+        EXPECT_THROW((void)orion::math::conjugate_gradient(matrix, b, x, {orion::math::Preconditioner::incomplete_cholesky}), std::invalid_argument);
+    }
+
+    TEST(ConjugateGradient, NotPositiveDefinite)
+    {
+        const std::vector<orion::math::Triplet<double>> triplets{{0, 0, 1}, {0, 1, 2}, {1, 0, 2}, {1, 1, 1}};
+        const auto matrix = orion::math::SparseMatrix<double>::from_triplets(2, 2, triplets);
+        const std::vector<double> b{1, 1};
+        std::vector<double> x(2);
+        EXPECT_THROW((void)orion::math::conjugate_gradient(matrix, b, x, {orion::math::Preconditioner::incomplete_cholesky}), std::invalid_argument);
+    }
+} // namespace
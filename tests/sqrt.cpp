@@ -1,6 +1,8 @@
 #include "orion-math/sqrt.h"
 
+#include <cstdint> // std::int32_t, std::uint8_t, std::uint64_t
 #include <gtest/gtest.h>
+#include <limits>  // std::numeric_limits
 
 TEST(Sqrt, IntegerResults)
 {
@@ -18,3 +20,25 @@ TEST(Sqrt, Zero)
 {
     EXPECT_EQ(orion::math::sqrt(0), 0);
 }
+
+TEST(Isqrt, PerfectSquares)
+{
+    static_assert(orion::math::isqrt(0) == 0);
+    static_assert(orion::math::isqrt(1) == 1);
+    EXPECT_EQ(orion::math::isqrt(4), 2);
+    EXPECT_EQ(orion::math::isqrt(1'000'000), 1'000);
+    EXPECT_EQ(orion::math::isqrt(std::uint64_t{4'294'967'296}), 65'536U);
+}
+
+TEST(Isqrt, RoundsDown)
+{
+    EXPECT_EQ(orion::math::isqrt(15), 3);
+    EXPECT_EQ(orion::math::isqrt(std::numeric_limits<std::int32_t>::max()), 46'340);
+    EXPECT_EQ(orion::math::isqrt(std::numeric_limits<std::uint64_t>::max()), 4'294'967'295U);
+    EXPECT_EQ(orion::math::isqrt(std::uint8_t{255}), 15);
+}
+
+TEST(Isqrt, Negative)
+{
+    EXPECT_EQ(orion::math::isqrt(-4), 0);
+}
@@ -0,0 +1,219 @@
+#include "orion-math/stream/stream.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <algorithm>  // std::max, std::min
+#include <cstddef>    // std::byte, std::size_t
+#include <cstdio>     // std::FILE, std::tmpfile, std::fopen, std::fread, std::fwrite, std::rewind
+#include <filesystem> // std::filesystem::path, std::filesystem::temp_directory_path
+#include <gtest/gtest.h>
+#include <span>       // std::span, std::as_bytes
+#include <stdexcept>  // std::invalid_argument, std::runtime_error
+#include <vector>     // std::vector
+
+namespace
+{
+    using orion::math::Vector3;
+
+    std::vector<Vector3> make_points(std::size_t count)
+    {
+        std::vector<Vector3> points(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto t = static_cast<float>(i);
+            points[i] = {t * .01f, static_cast<float>(i % 100) - 50, static_cast<float>(i % 7) * .3f};
+        }
+        return points;
+    }
+
+    std::vector<orion::math::PointStage<float>> make_stages()
+    {
+        return {
+            orion::math::transform_stage(orion::math::translation(1.f, 2.f, 3.f)),
+            orion::math::filter_stage(orion::math::Bounds<float, 3>{{0, -20, 3}, {60, 20, 4}}),
+            orion::math::quantize_stage(Vector3{0, 0, 0}, Vector3{.5f, .5f, .25f})};
+    }
+
+    // Applies the stages to the whole input at once
+    std::vector<Vector3> process_in_memory(std::vector<Vector3> points, const std::vector<orion::math::PointStage<float>>& stages)
+    {
+        auto view = std::span{points};
+        for (const auto& stage : stages) {
+            view = view.first(stage(view, 1));
+        }
+        return {view.begin(), view.end()};
+    }
+
+    std::vector<Vector3> read_all(std::FILE* file)
+    {
+        std::rewind(file);
+        std::vector<Vector3> result;
+        Vector3 point;
+        while (std::fread(&point, sizeof(point), 1, file) == 1) {
+            result.push_back(point);
+        }
+        return result;
+    }
+
+    // Produces count points without holding them and remembers the largest request
+    class GeneratedSource
+    {
+    public:
+        explicit GeneratedSource(std::size_t count)
+            : remaining_(count * sizeof(Vector3))
+        {
+        }
+
+        std::size_t read(std::span<std::byte> buffer)
+        {
+            largest_request = std::max(largest_request, buffer.size());
+            const auto count = std::min(buffer.size(), remaining_);
+            for (std::size_t i = 0; i < count; ++i) {
+                buffer[i] = std::byte{0};
+            }
+            remaining_ -= count;
+            return count;
+        }
+
+        std::size_t largest_request = 0;
+
+    private:
+        std::size_t remaining_;
+    };
+
+    class CountingSink
+    {
+    public:
+        void write(std::span<const std::byte> buffer)
+        {
+            largest_write = std::max(largest_write, buffer.size());
+            bytes += buffer.size();
+        }
+
+        std::size_t largest_write = 0;
+        std::size_t bytes = 0;
+    };
+
+    TEST(Stream, MatchesInMemoryProcessing)
+    {
+        const auto points = make_points(10'007);
+        const auto stages = make_stages();
+        const auto expected = process_in_memory(points, stages);
+        ASSERT_FALSE(expected.empty());
+        ASSERT_LT(expected.size(), points.size());
+
+        const auto directory = std::filesystem::temp_directory_path();
+        const auto input_path = directory / "orion_math_stream_input.bin";
+        const auto output_path = directory / "orion_math_stream_output.bin";
+        {
+            orion::math::FileSink input{input_path};
+            input.write(std::as_bytes(std::span{points}));
+        }
+
+        for (const unsigned threads : {1U, 3U}) {
+            orion::math::StreamResult result{};
+            {
+                orion::math::FileSource source{input_path};
+                orion::math::FileSink sink{output_path};
+                result = orion::math::stream_points(source, sink, stages, {1000, threads});
+            }
+            EXPECT_EQ(result.chunks, 11);
+            EXPECT_EQ(result.points_read, points.size());
+            EXPECT_EQ(result.points_written, expected.size());
+
+            auto* output = std::fopen(output_path.string().c_str(), "rb");
+            ASSERT_NE(output, nullptr);
+            EXPECT_EQ(read_all(output), expected);
+            std::fclose(output);
+        }
+        std::filesystem::remove(input_path);
+        std::filesystem::remove(output_path);
+    }
+
+    TEST(Stream, ExactMultipleOfChunkSize)
+    {
+        const auto points = make_points(4096);
+        auto* input = std::tmpfile();
+        auto* output = std::tmpfile();
+        ASSERT_NE(input, nullptr);
+        ASSERT_NE(output, nullptr);
+        std::fwrite(points.data(), sizeof(Vector3), points.size(), input);
+        std::rewind(input);
+
+        orion::math::FileSource source{input};
+        orion::math::FileSink sink{output};
+        const auto result = orion::math::stream_points(source, sink, {}, {1024});
+        EXPECT_EQ(result.chunks, 4);
+        EXPECT_EQ(result.points_written, points.size());
+        std::fflush(output);
+        EXPECT_EQ(read_all(output), points);
+        std::fclose(input);
+        std::fclose(output);
+    }
+
+    TEST(Stream, MemoryIsBoundedByChunkSize)
+    {
+        constexpr std::size_t chunk_size = 512;
+        GeneratedSource source{1'000'000};
+        CountingSink sink;
+        const auto result = orion::math::stream_points(source, sink, {}, {chunk_size});
+        EXPECT_EQ(result.points_read, 1'000'000);
+        EXPECT_EQ(sink.bytes, 1'000'000 * sizeof(Vector3));
+        EXPECT_LE(source.largest_request, chunk_size * sizeof(Vector3));
+        EXPECT_LE(sink.largest_write, chunk_size * sizeof(Vector3));
+    }
+
+    TEST(Stream, EmptyInput)
+    {
+        GeneratedSource source{0};
+        CountingSink sink;
+        const auto result = orion::math::stream_points(source, sink, make_stages());
+        EXPECT_EQ(result.chunks, 0);
+        EXPECT_EQ(result.points_read, 0);
+        EXPECT_EQ(sink.bytes, 0);
+    }
+
+    TEST(Stream, Errors)
+    {
+        CountingSink sink;
+
+        auto* truncated = std::tmpfile();
+        ASSERT_NE(truncated, nullptr);
+        const auto points = make_points(3);
+        std::fwrite(points.data(), 1, sizeof(Vector3) * points.size() - 4, truncated);
+        std::rewind(truncated);
+        orion::math::FileSource truncated_source{truncated};
+        EXPECT_THROW((void)orion::math::stream_points(truncated_source, sink, {}), std::runtime_error);
+        std::fclose(truncated);
+
+        GeneratedSource source{5000};
+        const std::vector<orion::math::PointStage<float>> failing{[](std::span<Vector3>, unsigned) -> std::size_t { throw std::runtime_error("stage failed"); }};
+        EXPECT_THROW((void)orion::math::stream_points(source, sink, failing, {1000}), std::runtime_error);
+
+        EXPECT_THROW((void)orion::math::stream_points(source, sink, {}, {0}), std::invalid_argument);
+        EXPECT_THROW((void)orion::math::quantize_stage(Vector3{}, Vector3{1, 0, 1}), std::invalid_argument);
+        EXPECT_THROW(orion::math::FileSource{std::filesystem::path{"/nonexistent/orion_math/points.bin"}}, std::runtime_error);
+    }
+
+#if __has_include(<unistd.h>)
+    TEST(Stream, Descriptors)
+    {
+        const auto points = make_points(3000);
+        auto* input = std::tmpfile();
+        auto* output = std::tmpfile();
+        ASSERT_NE(input, nullptr);
+        ASSERT_NE(output, nullptr);
+        std::fwrite(points.data(), sizeof(Vector3), points.size(), input);
+        std::fflush(input);
+        std::rewind(input);
+
+        orion::math::DescriptorSource source{fileno(input)};
+        orion::math::DescriptorSink sink{fileno(output)};
+        const auto stages = make_stages();
+        const auto result = orion::math::stream_points(source, sink, stages, {256, 2});
+        EXPECT_EQ(result.points_read, points.size());
+        EXPECT_EQ(read_all(output), process_in_memory(points, stages));
+        std::fclose(input);
+        std::fclose(output);
+    }
+#endif
+} // namespace
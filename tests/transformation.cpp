@@ -110,4 +110,38 @@ namespace
         EXPECT_NEAR(position_projected.y(), -.5f, acceptable_error);
         EXPECT_NEAR(position_projected.z(), -.5f, acceptable_error);
     }
+
+    TEST(Transformation, TransformPointPerspectiveDivide)
+    {
+        const orion::math::Vector3 position{1.f, 1.f, 5.f};
+        const auto projection = orion::math::perspective_fov_lh(orion::math::Degrees{90}, 1.f, 1.f, 9.f);
+        const auto projected = orion::math::transform_point(position, projection, orion::math::perspective_divide);
+        // w is the view space depth of 5
+        EXPECT_NEAR(projected.x(), .2f, 1e-5);
+        EXPECT_NEAR(projected.y(), .2f, 1e-5);
+        EXPECT_NEAR(projected.z(), -.9f, 1e-5);
+    }
+
+    TEST(Transformation, TransformDirection)
+    {
+        const orion::math::Vector3 direction{1, 0, 0};
+        const auto matrix = orion::math::rotation_z(orion::math::Degrees{90}) * orion::math::translation(5.f, 5.f, 5.f);
+        const auto transformed = orion::math::transform_direction(direction, matrix);
+        EXPECT_NEAR(transformed.x(), 0, 1e-6);
+        EXPECT_NEAR(transformed.y(), 1, 1e-6);
+        EXPECT_NEAR(transformed.z(), 0, 1e-6);
+    }
+
+    TEST(Transformation, TransformNormal)
+    {
+        // The normal of the plane x + y = 0 stays perpendicular to it under non-uniform scale
+        const orion::math::Vector3 normal{1, 1, 0};
+        const orion::math::Vector3 tangent{1, -1, 0};
+        const auto matrix = orion::math::scaling(2.f, 1.f, 1.f) * orion::math::translation(1.f, 2.f, 3.f);
+        const auto transformed_normal = orion::math::transform_normal(normal, matrix);
+        const auto transformed_tangent = orion::math::transform_direction(tangent, matrix);
+        EXPECT_NEAR(orion::math::dot(transformed_normal, transformed_tangent), 0, 1e-6);
+        EXPECT_NEAR(transformed_normal.x(), .5f, 1e-6);
+        EXPECT_NEAR(transformed_normal.y(), 1, 1e-6);
+    }
 } // namespace
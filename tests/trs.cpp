@@ -0,0 +1,104 @@
+#include "orion-math/matrix/trs.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    using namespace orion::math::angle_literals;
+
+    constexpr auto acceptable_error = 1e-5;
+
+    void expect_matrix_near(const orion::math::Matrix4& actual, const orion::math::Matrix4& expected)
+    {
+        for (std::size_t i = 0; i < 4; ++i) {
+            for (std::size_t j = 0; j < 4; ++j) {
+                EXPECT_NEAR(actual[i][j], expected[i][j], acceptable_error) << "at [" << i << "][" << j << "]";
+            }
+        }
+    }
+
+    TEST(Quaternion, RotationMatchesAxisRotations)
+    {
+        expect_matrix_near(orion::math::rotation(orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 30_deg)), orion::math::rotation_x(30_deg));
+        expect_matrix_near(orion::math::rotation(orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 1, 0}, 45_deg)), orion::math::rotation_y(45_deg));
+        expect_matrix_near(orion::math::rotation(orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 60_deg)), orion::math::rotation_z(60_deg));
+    }
+
+    TEST(Quaternion, Rotate)
+    {
+        const auto quaternion = orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 90_deg);
+        const auto rotated = orion::math::quaternion_rotate(quaternion, orion::math::Vector3{1, 0, 0});
+        EXPECT_NEAR(rotated.x(), 0, acceptable_error);
+        EXPECT_NEAR(rotated.y(), 1, acceptable_error);
+        EXPECT_NEAR(rotated.z(), 0, acceptable_error);
+    }
+
+    TEST(Quaternion, MultiplyAppliesRightHandSideFirst)
+    {
+        const auto first = orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 90_deg);
+        const auto second = orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 90_deg);
+        const auto combined = orion::math::quaternion_multiply(second, first);
+        expect_matrix_near(orion::math::rotation(combined), orion::math::rotation(first) * orion::math::rotation(second));
+    }
+
+    TEST(TRS, ToMatrix)
+    {
+        const orion::math::TRS<float> trs{
+            {1, 2, 3},
+            orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 1, 0}, 30_deg),
+            {2, 3, 4}};
+        const auto expected = orion::math::scaling(trs.scale) * orion::math::rotation_y(30_deg) * orion::math::translation(trs.translation);
+        expect_matrix_near(trs.to_matrix(), expected);
+        EXPECT_EQ(orion::math::TRS<float>::identity().to_matrix(), orion::math::Matrix4::identity());
+    }
+
+    TEST(TRS, Compose)
+    {
+        const orion::math::TRS<float> first{
+            {1, 0, 0},
+            orion::math::quaternion_from_axis_angle(orion::math::Vector3{1, 0, 0}, 20_deg),
+            {1, 2, 3}};
+        const orion::math::TRS<float> second{
+            {0, 5, 0},
+            orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 70_deg),
+            {2, 2, 2}};
+        expect_matrix_near(orion::math::compose(first, second).to_matrix(), first.to_matrix() * second.to_matrix());
+    }
+
+    TEST(TRS, Interpolate)
+    {
+        const orion::math::TRS<float> from{};
+        const orion::math::TRS<float> to{
+            {2, 4, 6},
+            orion::math::quaternion_from_axis_angle(orion::math::Vector3{0, 0, 1}, 90_deg),
+            {3, 3, 3}};
+        const auto halfway = orion::math::interpolate(from, to, .5f);
+        const orion::math::Vector3 expected_translation{1, 2, 3};
+        const orion::math::Vector3 expected_scale{2, 2, 2};
+        EXPECT_EQ(halfway.translation, expected_translation);
+        EXPECT_EQ(halfway.scale, expected_scale);
+        expect_matrix_near(orion::math::rotation(halfway.rotation), orion::math::rotation_z(45_deg));
+    }
+
+    TEST(TRS, Decompose)
+    {
+        const auto matrix = orion::math::scaling(1.f, 2.f, 3.f) * orion::math::rotation_x(30_deg) * orion::math::rotation_y(-50_deg) * orion::math::translation(4.f, 5.f, 6.f);
+        const auto trs = orion::math::decompose(matrix);
+        EXPECT_NEAR(trs.scale.x(), 1, acceptable_error);
+        EXPECT_NEAR(trs.scale.y(), 2, acceptable_error);
+        EXPECT_NEAR(trs.scale.z(), 3, acceptable_error);
+        const orion::math::Vector3 expected_translation{4, 5, 6};
+        EXPECT_EQ(trs.translation, expected_translation);
+        expect_matrix_near(trs.to_matrix(), matrix);
+    }
+
+    TEST(TRS, DecomposeMirrored)
+    {
+        const auto matrix = orion::math::scaling(-2.f, 1.f, 1.f) * orion::math::rotation_z(10_deg);
+        const auto trs = orion::math::decompose(matrix);
+        EXPECT_NEAR(trs.scale.x(), -2, acceptable_error);
+        expect_matrix_near(trs.to_matrix(), matrix);
+    }
+} // namespace
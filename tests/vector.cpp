@@ -2,6 +2,7 @@
 
 #include "orion-math/vector/formatter.h"
 
+#include <cstdint> // std::int32_t, std::int64_t
 #include <gtest/gtest.h>
 #include <iterator> // std::distance, std::next
 
@@ -74,6 +75,17 @@ TEST(Vector, Magnitude)
     EXPECT_NEAR(vector.magnitude(), 3.7416573867739413, 1e-8);
 }
 
+TEST(Vector, IntegerMagnitude)
+{
+    constexpr auto vector = orion::math::Vector{1, 2, 3};
+    static_assert(std::is_same_v<decltype(vector.integer_magnitude()), std::int64_t>);
+    static_assert(vector.integer_magnitude() == 3);
+    EXPECT_EQ(vector.integer_magnitude(), 3);
+
+    const auto large = orion::math::Vector<std::int32_t, 3>{300'000, 400'000, 1'200'000};
+    EXPECT_EQ(large.integer_magnitude(), 1'300'000);
+}
+
 TEST(Vector, Normalized)
 {
     const auto vector = orion::math::Vector{1, 2, 3};
@@ -204,6 +216,15 @@ TEST(Vector, DotProduct)
     EXPECT_EQ(orion::math::dot(lhs, rhs), expected);
 }
 
+TEST(Vector, DotProductWidensIntegers)
+{
+    constexpr std::int32_t large = 100'000;
+    const auto vector = orion::math::Vector{large, large, large};
+    static_assert(std::is_same_v<decltype(orion::math::dot(vector, vector)), std::int64_t>);
+    EXPECT_EQ(orion::math::dot(vector, vector), 30'000'000'000);
+    EXPECT_EQ(vector.sqr_magnitude(), 30'000'000'000);
+}
+
 TEST(Vector, CrossProduct)
 {
     const auto lhs = orion::math::Vector{1, 2, 3};
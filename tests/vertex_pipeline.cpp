@@ -0,0 +1,127 @@
+#include "orion-math/matrix/vertex_pipeline.h"
+
+#include "orion-math/matrix/transformation.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using namespace orion::math::angle_literals;
+
+    constexpr auto acceptable_error = 1e-4;
+
+    const auto mvp = orion::math::rotation_y(20_deg) *
+                     orion::math::translation(0.f, 0.f, -5.f) *
+                     orion::math::lookat_rh(orion::math::Vector3{0, 1, 2}, orion::math::Vector3{0, 0, -5}, orion::math::Vector3{0, 1, 0}) *
+                     orion::math::perspective_fov_rh(60_deg, 16.f / 9.f, .5f, 50.f);
+    constexpr orion::math::Viewport<float> viewport{10, 20, 1920, 1080, 0, 1};
+
+    std::vector<orion::math::Vector3> make_positions(std::size_t count)
+    {
+        std::vector<orion::math::Vector3> positions;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto t = static_cast<float>(i);
+            positions.push_back({(static_cast<float>(i % 13) - 6) * .7f, (static_cast<float>(i % 7) - 3) * .9f, -t * .05f + 3});
+        }
+        return positions;
+    }
+
+    TEST(VertexPipeline, Outcode)
+    {
+        EXPECT_EQ(orion::math::clip_outcode(orion::math::Vector4{0, 0, .5f, 1}), 0);
+        EXPECT_EQ(orion::math::clip_outcode(orion::math::Vector4{-2, 0, .5f, 1}), orion::math::clip_left);
+        EXPECT_EQ(orion::math::clip_outcode(orion::math::Vector4{2, 2, .5f, 1}), orion::math::clip_right | orion::math::clip_top);
+        EXPECT_EQ(orion::math::clip_outcode(orion::math::Vector4{0, -2, -1, 1}), orion::math::clip_bottom | orion::math::clip_near);
+        EXPECT_EQ(orion::math::clip_outcode(orion::math::Vector4{0, 0, 2, 1}), orion::math::clip_far);
+    }
+
+    TEST(VertexPipeline, MatchesScalarTransform)
+    {
+        const auto positions = make_positions(103);
+        std::vector<orion::math::Vector4> clip(positions.size());
+        std::vector<std::uint8_t> outcodes(positions.size());
+        std::vector<orion::math::Vector3> ndc(positions.size());
+        std::vector<orion::math::Vector3> screen(positions.size());
+        const auto summary = orion::math::project_vertices(positions, mvp, viewport, {clip, outcodes, ndc, screen});
+
+        std::uint8_t any = 0;
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            const auto& p = positions[i];
+            const auto expected = orion::math::Vector4{p.x(), p.y(), p.z(), 1} * mvp;
+            for (std::size_t j = 0; j < 4; ++j) {
+                EXPECT_NEAR(clip[i][j], expected[j], acceptable_error) << "vertex " << i;
+            }
+            EXPECT_EQ(outcodes[i], orion::math::clip_outcode(clip[i])) << "vertex " << i;
+            any |= outcodes[i];
+            if (outcodes[i] & orion::math::clip_near) {
+                continue;
+            }
+            const orion::math::Vector3 expected_ndc{expected[0] / expected[3], expected[1] / expected[3], expected[2] / expected[3]};
+            for (std::size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(ndc[i][j], expected_ndc[j], acceptable_error) << "vertex " << i;
+            }
+            EXPECT_NEAR(screen[i].x(), viewport.x + (expected_ndc.x() + 1) / 2 * viewport.width, 1e-2);
+            EXPECT_NEAR(screen[i].y(), viewport.y + (1 - expected_ndc.y()) / 2 * viewport.height, 1e-2);
+            EXPECT_NEAR(screen[i].z(), expected_ndc.z(), acceptable_error);
+        }
+        EXPECT_EQ(summary.any, any);
+        EXPECT_NE(any, 0);
+    }
+
+    TEST(VertexPipeline, ScreenCorners)
+    {
+        // NDC corners of the near plane land on the viewport corners
+        const auto projection = orion::math::perspective_fov_rh(90_deg, 1.f, 1.f, 10.f);
+        const std::vector<orion::math::Vector3> positions{{-1, 1, -1}, {1, -1, -1}, {0, 0, -10}};
+        std::vector<orion::math::Vector3> screen(positions.size());
+        const auto summary = orion::math::project_vertices(positions, projection, {0, 0, 640, 480, 0, 1}, {.screen = screen});
+        EXPECT_EQ(summary.any, 0);
+        EXPECT_NEAR(screen[0].x(), 0, acceptable_error);
+        EXPECT_NEAR(screen[0].y(), 0, acceptable_error);
+        EXPECT_NEAR(screen[0].z(), 0, acceptable_error);
+        EXPECT_NEAR(screen[1].x(), 640, acceptable_error);
+        EXPECT_NEAR(screen[1].y(), 480, acceptable_error);
+        EXPECT_NEAR(screen[2].x(), 320, acceptable_error);
+        EXPECT_NEAR(screen[2].y(), 240, acceptable_error);
+        EXPECT_NEAR(screen[2].z(), 1, acceptable_error);
+    }
+
+    TEST(VertexPipeline, SummaryCullsBatch)
+    {
+        const auto projection = orion::math::perspective_fov_rh(90_deg, 1.f, 1.f, 10.f);
+        const std::vector<orion::math::Vector3> behind{{0, 0, 1}, {1, 1, 2}, {-1, 0, 3}, {0, 2, .5f}, {3, 3, 3}};
+        const auto culled = orion::math::project_vertices(behind, projection, viewport, {});
+        EXPECT_NE(culled.all & orion::math::clip_near, 0);
+
+        const std::vector<orion::math::Vector3> visible{{0, 0, -2}};
+        const auto kept = orion::math::project_vertices(visible, projection, viewport, {});
+        EXPECT_EQ(kept.any, 0);
+        EXPECT_EQ(kept.all, 0);
+
+        const auto empty = orion::math::project_vertices({}, projection, viewport, {});
+        EXPECT_EQ(empty.any, 0);
+        EXPECT_EQ(empty.all, 0);
+    }
+
+    TEST(VertexPipeline, Threads)
+    {
+        const auto positions = make_positions(10'001);
+        std::vector<orion::math::Vector3> single(positions.size());
+        std::vector<orion::math::Vector3> threaded(positions.size());
+        std::vector<std::uint8_t> outcodes(positions.size());
+        const auto single_summary = orion::math::project_vertices(positions, mvp, viewport, {.screen = single});
+        const auto threaded_summary = orion::math::project_vertices(positions, mvp, viewport, {.outcodes = outcodes, .screen = threaded}, 4);
+        EXPECT_EQ(single, threaded);
+        EXPECT_EQ(single_summary.any, threaded_summary.any);
+        EXPECT_EQ(single_summary.all, threaded_summary.all);
+    }
+
+    TEST(VertexPipeline, SizeMismatchThrows)
+    {
+        const auto positions = make_positions(8);
+        std::vector<orion::math::Vector3> screen(7);
+        EXPECT_THROW((void)orion::math::project_vertices(positions, mvp, viewport, {.screen = screen}), std::invalid_argument);
+    }
+} // namespace
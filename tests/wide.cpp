@@ -0,0 +1,219 @@
+#include "orion-math/vector/wide.h"
+
+#include "orion-math/matrix/transformation.h"
+#include "orion-math/vector/vector3.h"
+
+#include <gtest/gtest.h>
+#include <array>     // std::array
+#include <cmath>     // std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t
+#include <stdexcept> // std::invalid_argument
+#include <vector>    // std::vector
+
+namespace
+{
+    using namespace orion::math::angle_literals;
+
+    constexpr auto acceptable_error = 1e-5;
+
+    template<typename Wide>
+    std::vector<typename Wide::scalar_vector> make_vectors(float offset)
+    {
+        std::vector<typename Wide::scalar_vector> result(Wide::lanes);
+        for (std::size_t lane = 0; lane < Wide::lanes; ++lane) {
+            for (std::size_t i = 0; i < result[lane].size(); ++i) {
+                result[lane][i] = static_cast<typename Wide::scalar_type>(offset + static_cast<float>(lane) * .75f - static_cast<float>(i) * 1.5f);
+            }
+        }
+        return result;
+    }
+
+    template<typename Vector>
+    void expect_vector_near(const Vector& actual, const Vector& expected)
+    {
+        for (std::size_t i = 0; i < actual.size(); ++i) {
+            EXPECT_NEAR(actual[i], expected[i], acceptable_error) << "at [" << i << "]";
+        }
+    }
+
+    template<typename Wide>
+    class WideVectorTest : public ::testing::Test
+    {
+    };
+
+    // x8_f and x4_d are native AVX packs or plain arrays without AVX, x4_f is native SSE and double x8 is always a plain array
+    using WideTypes = ::testing::Types<orion::math::Vector3x8_f, orion::math::Vector3x4_f, orion::math::Vector3x4_d, orion::math::WideVector3_t<double, 8>>;
+    TYPED_TEST_SUITE(WideVectorTest, WideTypes);
+
+    TYPED_TEST(WideVectorTest, LoadStore)
+    {
+        const auto vectors = make_vectors<TypeParam>(1);
+        const auto wide = TypeParam::load(vectors);
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            EXPECT_EQ(wide.lane(lane), vectors[lane]);
+            EXPECT_EQ(wide.y()[lane], vectors[lane].y());
+        }
+        std::vector<typename TypeParam::scalar_vector> stored(TypeParam::lanes);
+        wide.store(stored);
+        EXPECT_EQ(stored, vectors);
+        EXPECT_EQ(TypeParam::broadcast(vectors[2]).lane(TypeParam::lanes - 1), vectors[2]);
+
+        std::vector<typename TypeParam::scalar_vector> too_small(TypeParam::lanes - 1);
+        EXPECT_THROW((void)TypeParam::load(too_small), std::invalid_argument);
+    }
+
+    TYPED_TEST(WideVectorTest, MatchesScalarVector)
+    {
+        const auto lhs = make_vectors<TypeParam>(1);
+        const auto rhs = make_vectors<TypeParam>(-3);
+        const auto wide_lhs = TypeParam::load(lhs);
+        const auto wide_rhs = TypeParam::load(rhs);
+        const auto sum = wide_lhs + wide_rhs;
+        const auto difference = wide_lhs - wide_rhs;
+        const auto negated = -wide_lhs;
+        const auto scaled = wide_lhs * 2 / 4;
+        const auto products = dot(wide_lhs, wide_rhs);
+        const auto crossed = cross(wide_lhs, wide_rhs);
+        const auto normalized = wide_lhs.normalized();
+        const auto magnitudes = wide_rhs.magnitude();
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            expect_vector_near(sum.lane(lane), lhs[lane] + rhs[lane]);
+            expect_vector_near(difference.lane(lane), lhs[lane] - rhs[lane]);
+            expect_vector_near(negated.lane(lane), -lhs[lane]);
+            expect_vector_near(scaled.lane(lane), lhs[lane] * 2 / 4);
+            EXPECT_NEAR(products[lane], dot(lhs[lane], rhs[lane]), acceptable_error);
+            expect_vector_near(crossed.lane(lane), cross(lhs[lane], rhs[lane]));
+            expect_vector_near(normalized.lane(lane), lhs[lane] / std::sqrt(lhs[lane].sqr_magnitude()));
+            EXPECT_NEAR(magnitudes[lane], std::sqrt(rhs[lane].sqr_magnitude()), acceptable_error);
+        }
+    }
+
+    // Plain fused cross rounds only one product per component
+#if !defined(ORION_MATH_FMA) || defined(ORION_MATH_PRECISE_FMA)
+    TYPED_TEST(WideVectorTest, CrossIsAntisymmetric)
+    {
+        // Components whose products round, so a fused multiply-add that rounds only one of them shows up
+        using T = typename TypeParam::scalar_type;
+        std::vector<typename TypeParam::scalar_vector> lhs(TypeParam::lanes);
+        std::vector<typename TypeParam::scalar_vector> rhs(TypeParam::lanes);
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            const auto offset = static_cast<T>(lane) * T{.37};
+            lhs[lane] = {T{.1} + offset, T{.7} - offset, T{1.3} + offset};
+            rhs[lane] = {T{3.7} - offset, T{.45} + offset, T{-1.1} + offset};
+        }
+        const auto wide_lhs = TypeParam::load(lhs);
+        const auto wide_rhs = TypeParam::load(rhs);
+        const auto self = cross(wide_lhs, wide_lhs);
+        const auto forward = cross(wide_lhs, wide_rhs);
+        const auto backward = cross(wide_rhs, wide_lhs);
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            EXPECT_EQ(self.lane(lane), typename TypeParam::scalar_vector{}) << "in lane " << lane;
+            EXPECT_EQ(forward.lane(lane), -backward.lane(lane)) << "in lane " << lane;
+        }
+    }
+#endif
+
+    TYPED_TEST(WideVectorTest, Transform)
+    {
+        using T = typename TypeParam::scalar_type;
+        const auto matrix = orion::math::scaling(T{2}, T{1}, T{3}) * orion::math::rotation_y(40_deg) * orion::math::translation(T{1}, T{-2}, T{5});
+        const auto points = make_vectors<TypeParam>(2);
+        const auto transformed = orion::math::transform(TypeParam::load(points), matrix);
+        const auto directions = orion::math::transform_direction(TypeParam::load(points), matrix);
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            expect_vector_near(transformed.lane(lane), orion::math::transform(points[lane], matrix));
+            expect_vector_near(directions.lane(lane), orion::math::transform_direction(points[lane], matrix));
+        }
+    }
+
+    TYPED_TEST(WideVectorTest, MasksAndSelect)
+    {
+        using Pack = typename TypeParam::value_type;
+        using Mask = typename TypeParam::mask_type;
+        const auto lhs = make_vectors<TypeParam>(1);
+        const auto rhs = make_vectors<TypeParam>(4);
+        const auto wide_lhs = TypeParam::load(lhs);
+        const auto wide_rhs = TypeParam::load(rhs);
+
+        // x of lhs runs 1, 1.75, 2.5, ... so lanes 0 to 3 lie below 4
+        const auto below = wide_lhs.x() < Pack::broadcast(4);
+        EXPECT_EQ(below.bits(), 0b1111U);
+        EXPECT_TRUE(orion::math::simd::any(below));
+        EXPECT_EQ(orion::math::simd::all(below), TypeParam::lanes == 4);
+        EXPECT_FALSE(orion::math::simd::none(below));
+        EXPECT_TRUE(orion::math::simd::none(below & !below));
+        EXPECT_TRUE(orion::math::simd::all(below | !below));
+        EXPECT_TRUE(orion::math::simd::all(wide_lhs.x() == wide_lhs.x()));
+        EXPECT_TRUE(orion::math::simd::all(wide_lhs.x() != wide_rhs.x()));
+        EXPECT_TRUE(orion::math::simd::all((wide_lhs.x() <= wide_lhs.x()) ^ Mask::broadcast(false)));
+        EXPECT_EQ((wide_lhs.x() >= Pack::broadcast(4)).bits(), (!below).bits());
+        EXPECT_EQ((wide_lhs.x() > Pack::broadcast(3.5)).bits(), (!below).bits());
+
+        const auto selected = orion::math::select(below, wide_lhs, wide_rhs);
+        const auto lower = orion::math::min(wide_lhs, wide_rhs);
+        const auto upper = orion::math::max(wide_lhs, wide_rhs);
+        for (std::size_t lane = 0; lane < TypeParam::lanes; ++lane) {
+            EXPECT_EQ(below[lane], lane < 4);
+            EXPECT_EQ(selected.lane(lane), lane < 4 ? lhs[lane] : rhs[lane]);
+            EXPECT_EQ(lower.lane(lane), lhs[lane]);
+            EXPECT_EQ(upper.lane(lane), rhs[lane]);
+        }
+    }
+
+    template<typename T>
+    void expect_transposed()
+    {
+        using Pack = orion::math::simd::Pack<T, 4>;
+        std::array<Pack, 4> rows;
+        for (std::size_t i = 0; i < 4; ++i) {
+            const std::array<T, 4> values{static_cast<T>(4 * i), static_cast<T>(4 * i + 1), static_cast<T>(4 * i + 2), static_cast<T>(4 * i + 3)};
+            rows[i] = Pack::load(values.data());
+        }
+        orion::math::simd::transpose(rows);
+        for (std::size_t i = 0; i < 4; ++i) {
+            for (std::size_t j = 0; j < 4; ++j) {
+                EXPECT_EQ(rows[i][j], static_cast<T>(4 * j + i)) << "at [" << i << "][" << j << "]";
+            }
+        }
+    }
+
+    // Shuffles for float with SSE2 and double with AVX, integers and builds without them take the generic path
+    TEST(WideVector, Transpose)
+    {
+        expect_transposed<float>();
+        expect_transposed<double>();
+        expect_transposed<std::int32_t>();
+    }
+
+    // Scalar-looking code running one lane per ray: distance along each ray to a sphere, or -1 on a miss
+    TEST(WideVector, RaySphere)
+    {
+        using Pack = orion::math::Vector3x8_f::value_type;
+        std::vector<orion::math::Vector3> origins(8);
+        std::vector<orion::math::Vector3> directions(8, orion::math::Vector3{0, 0, -1});
+        for (std::size_t lane = 0; lane < 8; ++lane) {
+            origins[lane] = {static_cast<float>(lane) * .5f, 0, 5};
+        }
+        const auto origin = orion::math::Vector3x8_f::load(origins);
+        const auto direction = orion::math::Vector3x8_f::load(directions);
+        const auto center = orion::math::Vector3x8_f::broadcast({0, 0, 0});
+        const auto radius = Pack::broadcast(1.5f);
+
+        const auto offset = origin - center;
+        const auto b = dot(offset, direction);
+        const auto c = dot(offset, offset) - radius * radius;
+        const auto discriminant = b * b - c;
+        const auto hit = discriminant >= Pack::broadcast(0);
+        const auto distance = select(hit, -b - sqrt(max(discriminant, Pack::broadcast(0))), Pack::broadcast(-1));
+
+        for (std::size_t lane = 0; lane < 8; ++lane) {
+            const auto x = static_cast<float>(lane) * .5f;
+            if (x <= 1.5f) {
+                EXPECT_NEAR(distance[lane], 5 - std::sqrt(1.5f * 1.5f - x * x), acceptable_error);
+            } else {
+                EXPECT_EQ(distance[lane], -1);
+            }
+        }
+    }
+} // namespace